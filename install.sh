@@ -45,11 +45,11 @@ if echo $REPLY | grep -E '^[Yy]$' > /dev/null; then
             echo "Installing dependencies (this may take a while)..."
             if sudo apt-get update >/dev/null; then
 
-                requiredgccmajor="7"
-                requiredgccminor="2"
+                requiredgccmajor="11"
+                requiredgccminor="1"
 
                 requiredgcc="${requiredgccmajor}.${requiredgccminor}"
-                availablegcc=$(apt-cache policy gcc-7 2>&1 | grep '^  Candidate: ' | sed -e 's/^  Candidate: \([0-9]\.[0-9]\).*/\1/')
+                availablegcc=$(apt-cache policy gcc-${requiredgccmajor} 2>&1 | grep '^  Candidate: ' | sed -e 's/^  Candidate: \([0-9]*\.[0-9]*\).*/\1/')
                 if [[ -z "${availablegcc// }" || "${availablegcc}" < "${requiredgcc}" ]]; then
                     if [[ -z $OPOSSUM_HEADLESS_SETUP ]]; then
                         read -p "The required GCC version ${requiredgcc} is not available in your installed repositories. OK to add ppa:ubuntu-toolchain-r/test? [y|n] " -n 1 -r < /dev/tty
@@ -59,16 +59,15 @@ if echo $REPLY | grep -E '^[Yy]$' > /dev/null; then
                     echo
                     if echo $REPLY | grep -E '^[Yy]$' > /dev/null; then
                         sudo apt-get install -y software-properties-common
-                        # We are using xenial here because 17.04 does not have a gcc-7.2 package
                         sudo apt-key adv --keyserver keyserver.ubuntu.com --recv-keys 1E9377A2BA9EF27F
-                        sudo add-apt-repository -y "deb http://ppa.launchpad.net/ubuntu-toolchain-r/test/ubuntu xenial main"
+                        sudo add-apt-repository -y "deb http://ppa.launchpad.net/ubuntu-toolchain-r/test/ubuntu $(lsb_release -cs) main"
                         sudo apt-get update
                     else
                         echo "Ok, you will have to install gcc $requiredgcc yourself."
                     fi
                 fi
 
-                requiredclang="5.0"
+                requiredclang="16"
                 availableclang=$(apt-cache policy clang-$requiredclang 2>&1 | grep '^  Candidate: ')
                 if [[ -z "${availableclang// }" ]]; then
                     if [[ -z $OPOSSUM_HEADLESS_SETUP ]]; then
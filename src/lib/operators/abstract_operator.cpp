@@ -0,0 +1,77 @@
+#include "abstract_operator.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator> left,
+                                   const std::shared_ptr<const AbstractOperator> right)
+    : _input_left(left), _input_right(right) {}
+
+void AbstractOperator::execute() { this->_output = this->_on_execute(); }
+
+std::shared_ptr<const Table> AbstractOperator::get_output() const {
+  DebugAssert(this->_output != nullptr, "Operator has not been executed yet");
+  return this->_output;
+}
+
+std::shared_ptr<const Table> AbstractOperator::_input_table_left() const { return this->_input_left->get_output(); }
+
+std::shared_ptr<const Table> AbstractOperator::_input_table_right() const { return this->_input_right->get_output(); }
+
+void AbstractOperator::_add_reference_columns(Chunk& output_chunk, const std::shared_ptr<const Table>& input_table,
+                                              const std::shared_ptr<const PosList>& pos_list) {
+  // columns that share their position lists (e.g., all columns of a scan result) also share the resolved list
+  std::map<std::vector<const PosList*>, std::shared_ptr<const PosList>> resolved_pos_lists;
+
+  for (ColumnID column_id{0}; column_id < input_table->col_count(); ++column_id) {
+    const auto first_column = input_table->get_chunk(ChunkID{0}).get_column(column_id);
+    const auto first_reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(first_column);
+    if (!first_reference_column) {
+      output_chunk.add_column(std::make_shared<ReferenceColumn>(input_table, column_id, pos_list));
+      continue;
+    }
+
+    std::vector<std::shared_ptr<const ReferenceColumn>> reference_columns;
+    std::vector<const PosList*> input_pos_lists;
+    for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      const auto column = input_table->get_chunk(chunk_id).get_column(column_id);
+      // the resolved positions refer to the table and column of the first chunk, so all chunks have to match it
+      DebugAssert(std::dynamic_pointer_cast<const ReferenceColumn>(column), "Mixed reference and data columns");
+      reference_columns.push_back(std::static_pointer_cast<const ReferenceColumn>(column));
+      DebugAssert(reference_columns.back()->referenced_table() == first_reference_column->referenced_table() &&
+                      reference_columns.back()->referenced_column_id() ==
+                          first_reference_column->referenced_column_id(),
+                  "All chunks of a column must reference the same table and column");
+      input_pos_lists.push_back(reference_columns.back()->pos_list().get());
+    }
+
+    auto& resolved_pos_list = resolved_pos_lists[input_pos_lists];
+    if (!resolved_pos_list) {
+      auto new_pos_list = std::make_shared<PosList>();
+      new_pos_list->reserve(pos_list->size());
+      for (const auto& row_id : *pos_list) {
+        if (row_id == NULL_ROW_ID) {
+          new_pos_list->push_back(NULL_ROW_ID);
+          continue;
+        }
+        new_pos_list->push_back((*reference_columns[row_id.chunk_id]->pos_list())[row_id.chunk_offset]);
+      }
+      resolved_pos_list = new_pos_list;
+    }
+
+    output_chunk.add_column(std::make_shared<ReferenceColumn>(first_reference_column->referenced_table(),
+                                                              first_reference_column->referenced_column_id(),
+                                                              resolved_pos_list));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// AbstractOperator is the abstract super class for all operators.
+// All operators have up to two input tables and one output table.
+// Their lifecycle has two phases: construction and execution. After execute() was called, the result can be
+// retrieved using get_output().
+class AbstractOperator : private Noncopyable {
+ public:
+  AbstractOperator(const std::shared_ptr<const AbstractOperator> left = nullptr,
+                   const std::shared_ptr<const AbstractOperator> right = nullptr);
+
+  virtual ~AbstractOperator() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  AbstractOperator(AbstractOperator&&) = default;
+  AbstractOperator& operator=(AbstractOperator&&) = default;
+
+  void execute();
+
+  // returns the result of the operator
+  std::shared_ptr<const Table> get_output() const;
+
+ protected:
+  // abstract method to actually execute the operator
+  // execute and get_output are split into two methods to allow for easier
+  // asynchronous execution
+  virtual std::shared_ptr<const Table> _on_execute() = 0;
+
+  std::shared_ptr<const Table> _input_table_left() const;
+  std::shared_ptr<const Table> _input_table_right() const;
+
+  // Adds ReferenceColumns for all columns of the input table to the output chunk. The positions refer to the input
+  // table. If the input table itself consists of ReferenceColumns, the positions are resolved, so that the new
+  // columns point to the tables that actually hold the data. NULL_ROW_IDs stay as they are.
+  static void _add_reference_columns(Chunk& output_chunk, const std::shared_ptr<const Table>& input_table,
+                                     const std::shared_ptr<const PosList>& pos_list);
+
+  // Shared pointers to input operators, can be nullptr.
+  std::shared_ptr<const AbstractOperator> _input_left;
+  std::shared_ptr<const AbstractOperator> _input_right;
+
+  // Is nullptr until the operator is executed
+  std::shared_ptr<const Table> _output;
+};
+
+}  // namespace opossum
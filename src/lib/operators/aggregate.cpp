@@ -0,0 +1,447 @@
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/for_each_value.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/mixed_hash.hpp"
+#include "utils/normalized_key.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The partial aggregates are merged by partitions of the groups. Like in JoinHash, the hash table of a partition
+// should stay in the cache, and more than 2^10 partitions make the partitioning itself expensive.
+constexpr auto GROUPS_PER_PARTITION = size_t{8192};
+constexpr auto MAX_RADIX_BITS = size_t{10};
+
+// BaseAggregateStates holds the aggregates of all groups of one chunk, or of the whole input after merging
+class BaseAggregateStates {
+ public:
+  virtual ~BaseAggregateStates() = default;
+};
+
+template <typename T>
+class AggregateStates : public BaseAggregateStates {
+ public:
+  using SumType = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+
+  explicit AggregateStates(const size_t group_count) : counts(group_count), sums(group_count), extrema(group_count) {}
+
+  // the number of aggregated values of each group, also used by AVG and to tell whether extrema has been set
+  std::vector<uint64_t> counts;
+  // the sums for SUM and AVG
+  std::vector<SumType> sums;
+  // the minimum or maximum for MIN and MAX
+  std::vector<T> extrema;
+};
+
+// BaseAggregator is the non-templated base of the typed implementation of one aggregate
+class BaseAggregator {
+ public:
+  virtual ~BaseAggregator() = default;
+
+  virtual std::unique_ptr<BaseAggregateStates> make_states(const size_t group_count) const = 0;
+
+  // aggregates the value of each row of a column into the group given by group_ids
+  virtual void aggregate(const BaseColumn& column, const std::vector<size_t>& group_ids,
+                         BaseAggregateStates& states) const = 0;
+
+  // merges the aggregates of the groups source_group_ids of source into the groups target_group_ids of target
+  virtual void merge(const BaseAggregateStates& source, const std::vector<size_t>& source_group_ids,
+                     const std::vector<size_t>& target_group_ids, BaseAggregateStates& target) const = 0;
+
+  virtual std::shared_ptr<BaseColumn> make_output_column(const BaseAggregateStates& states) const = 0;
+
+  virtual std::string output_type() const = 0;
+};
+
+template <typename T>
+class Aggregator : public BaseAggregator {
+ public:
+  Aggregator(const AggregateFunction function, const std::string& column_type)
+      : _function(function), _column_type(column_type) {
+    Assert(std::is_arithmetic_v<T> || (function != AggregateFunction::Sum && function != AggregateFunction::Avg),
+           "SUM and AVG are not defined for " + column_type + " columns");
+  }
+
+  std::unique_ptr<BaseAggregateStates> make_states(const size_t group_count) const override {
+    return std::make_unique<AggregateStates<T>>(group_count);
+  }
+
+  void aggregate(const BaseColumn& column, const std::vector<size_t>& group_ids,
+                 BaseAggregateStates& base_states) const override {
+    auto& states = static_cast<AggregateStates<T>&>(base_states);
+
+    switch (this->_function) {
+      case AggregateFunction::Count:
+        for_each_value<T>(column, [&](const T&, const ChunkOffset offset) { ++states.counts[group_ids[offset]]; });
+        break;
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        if constexpr (std::is_arithmetic_v<T>) {
+          for_each_value<T>(column, [&](const T& value, const ChunkOffset offset) {
+            const auto group_id = group_ids[offset];
+            states.sums[group_id] += value;
+            ++states.counts[group_id];
+          });
+        }
+        break;
+      case AggregateFunction::Min:
+        for_each_value<T>(column, [&](const T& value, const ChunkOffset offset) {
+          const auto group_id = group_ids[offset];
+          if (states.counts[group_id]++ == 0 || value < states.extrema[group_id]) states.extrema[group_id] = value;
+        });
+        break;
+      case AggregateFunction::Max:
+        for_each_value<T>(column, [&](const T& value, const ChunkOffset offset) {
+          const auto group_id = group_ids[offset];
+          if (states.counts[group_id]++ == 0 || states.extrema[group_id] < value) states.extrema[group_id] = value;
+        });
+        break;
+    }
+  }
+
+  void merge(const BaseAggregateStates& base_source, const std::vector<size_t>& source_group_ids,
+             const std::vector<size_t>& target_group_ids, BaseAggregateStates& base_target) const override {
+    const auto& source = static_cast<const AggregateStates<T>&>(base_source);
+    auto& target = static_cast<AggregateStates<T>&>(base_target);
+
+    for (size_t index = 0; index < source_group_ids.size(); ++index) {
+      const auto source_group_id = source_group_ids[index];
+      const auto source_count = source.counts[source_group_id];
+      if (source_count == 0) continue;
+
+      const auto target_group_id = target_group_ids[index];
+      const auto& source_extremum = source.extrema[source_group_id];
+      auto& target_extremum = target.extrema[target_group_id];
+
+      if (this->_function == AggregateFunction::Min) {
+        if (target.counts[target_group_id] == 0 || source_extremum < target_extremum) target_extremum = source_extremum;
+      } else if (this->_function == AggregateFunction::Max) {
+        if (target.counts[target_group_id] == 0 || target_extremum < source_extremum) target_extremum = source_extremum;
+      }
+      target.sums[target_group_id] += source.sums[source_group_id];
+      target.counts[target_group_id] += source_count;
+    }
+  }
+
+  std::shared_ptr<BaseColumn> make_output_column(const BaseAggregateStates& base_states) const override {
+    const auto& states = static_cast<const AggregateStates<T>&>(base_states);
+
+    // MIN, MAX and AVG of a group without values (i.e., only NULLs) are NULL, which the output columns cannot hold
+    if (this->_function == AggregateFunction::Min || this->_function == AggregateFunction::Max ||
+        this->_function == AggregateFunction::Avg) {
+      Assert(std::find(states.counts.cbegin(), states.counts.cend(), 0u) == states.counts.cend(),
+             "Aggregate cannot output the NULL that MIN, MAX and AVG return for a group without values");
+    }
+
+    switch (this->_function) {
+      case AggregateFunction::Count:
+        return std::make_shared<ValueColumn<int64_t>>(
+            std::vector<int64_t>(states.counts.cbegin(), states.counts.cend()));
+      case AggregateFunction::Sum:
+        return std::make_shared<ValueColumn<typename AggregateStates<T>::SumType>>(
+            std::vector<typename AggregateStates<T>::SumType>(states.sums));
+      case AggregateFunction::Avg: {
+        std::vector<double> averages(states.counts.size());
+        for (size_t group_id = 0; group_id < averages.size(); ++group_id) {
+          averages[group_id] = static_cast<double>(states.sums[group_id]) / states.counts[group_id];
+        }
+        return std::make_shared<ValueColumn<double>>(std::move(averages));
+      }
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        return std::make_shared<ValueColumn<T>>(std::vector<T>(states.extrema));
+    }
+    Fail("Unknown aggregate function");
+  }
+
+  std::string output_type() const override {
+    switch (this->_function) {
+      case AggregateFunction::Count:
+        return "long";
+      case AggregateFunction::Sum:
+        return std::is_integral_v<T> ? "long" : "double";
+      case AggregateFunction::Avg:
+        return "double";
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        return this->_column_type;
+    }
+    Fail("Unknown aggregate function");
+  }
+
+ protected:
+  const AggregateFunction _function;
+  const std::string _column_type;
+};
+
+std::string aggregate_function_name(const AggregateFunction function) {
+  switch (function) {
+    case AggregateFunction::Count:
+      return "COUNT";
+    case AggregateFunction::Sum:
+      return "SUM";
+    case AggregateFunction::Min:
+      return "MIN";
+    case AggregateFunction::Max:
+      return "MAX";
+    case AggregateFunction::Avg:
+      return "AVG";
+  }
+  Fail("Unknown aggregate function");
+}
+
+// the groups of one chunk with their keys and aggregates
+template <typename Key>
+struct PartialAggregate {
+  std::vector<Key> group_keys;
+  std::vector<std::unique_ptr<BaseAggregateStates>> states;
+};
+
+// Groups the rows of the input by the keys that make_row_keys returns for each chunk and computes the aggregates.
+// Fills group_keys with the key of each group and aggregate_columns with one output column per aggregator.
+template <typename Key, typename MakeRowKeys>
+void aggregate_groups(const Table& input_table, const std::vector<AggregateDefinition>& definitions,
+                      const std::vector<std::unique_ptr<BaseAggregator>>& aggregators,
+                      const MakeRowKeys& make_row_keys, std::vector<Key>& group_keys,
+                      std::vector<std::shared_ptr<BaseColumn>>& aggregate_columns) {
+  // each chunk is aggregated into its own hash table
+  std::vector<PartialAggregate<Key>> partial_aggregates(input_table.chunk_count());
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < input_table.chunk_count(); ++chunk_id) {
+    const auto& chunk = input_table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& partial_aggregate = partial_aggregates[chunk_id];
+      auto row_keys = make_row_keys(chunk);
+
+      std::unordered_map<Key, size_t> group_ids_by_key;
+      std::vector<size_t> group_ids(chunk.size());
+      for (ChunkOffset offset{0}; offset < chunk.size(); ++offset) {
+        const auto group_id = partial_aggregate.group_keys.size();
+        const auto inserted = group_ids_by_key.try_emplace(std::move(row_keys[offset]), group_id);
+        if (inserted.second) partial_aggregate.group_keys.push_back(inserted.first->first);
+        group_ids[offset] = inserted.first->second;
+      }
+
+      for (size_t aggregate_id = 0; aggregate_id < aggregators.size(); ++aggregate_id) {
+        const auto& aggregator = *aggregators[aggregate_id];
+        auto states = aggregator.make_states(partial_aggregate.group_keys.size());
+        aggregator.aggregate(*chunk.get_column(definitions[aggregate_id].column_id), group_ids, *states);
+        partial_aggregate.states.push_back(std::move(states));
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // The groups of all chunks are split into partitions by the hash of their keys, so that the groups of one key all
+  // end up in the same partition. Each partition is then merged by its own job.
+  auto partial_group_count = size_t{0};
+  for (const auto& partial_aggregate : partial_aggregates) partial_group_count += partial_aggregate.group_keys.size();
+  auto radix_bits = size_t{0};
+  while (radix_bits < MAX_RADIX_BITS && (GROUPS_PER_PARTITION << radix_bits) < partial_group_count) ++radix_bits;
+  const auto partition_count = size_t{1} << radix_bits;
+  const auto partition_mask = partition_count - 1;
+
+  // the ids of the groups of each chunk, by partition
+  std::vector<std::vector<std::vector<size_t>>> partitioned_group_ids(partial_aggregates.size());
+  jobs.clear();
+  for (size_t chunk_id = 0; chunk_id < partial_aggregates.size(); ++chunk_id) {
+    if (partial_aggregates[chunk_id].group_keys.empty()) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto& chunk_group_keys = partial_aggregates[chunk_id].group_keys;
+      auto& group_ids_by_partition = partitioned_group_ids[chunk_id];
+      group_ids_by_partition.resize(partition_count);
+      for (size_t group_id = 0; group_id < chunk_group_keys.size(); ++group_id) {
+        group_ids_by_partition[mixed_hash(chunk_group_keys[group_id]) & partition_mask].push_back(group_id);
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // each partition numbers its groups starting at 0. As the partitions are disjoint, their jobs write to different
+  // elements of group_mappings.
+  std::vector<std::vector<Key>> partition_group_keys(partition_count);
+  std::vector<std::vector<size_t>> group_mappings(partial_aggregates.size());
+  for (size_t chunk_id = 0; chunk_id < partial_aggregates.size(); ++chunk_id) {
+    group_mappings[chunk_id].resize(partial_aggregates[chunk_id].group_keys.size());
+  }
+  jobs.clear();
+  for (size_t partition_id = 0; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      std::unordered_map<Key, size_t> group_ids_by_key;
+      auto& keys = partition_group_keys[partition_id];
+      for (size_t chunk_id = 0; chunk_id < partial_aggregates.size(); ++chunk_id) {
+        if (partitioned_group_ids[chunk_id].empty()) continue;
+
+        for (const auto group_id : partitioned_group_ids[chunk_id][partition_id]) {
+          const auto& key = partial_aggregates[chunk_id].group_keys[group_id];
+          const auto inserted = group_ids_by_key.try_emplace(key, keys.size());
+          if (inserted.second) keys.push_back(key);
+          group_mappings[chunk_id][group_id] = inserted.first->second;
+        }
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // the final group ids of a partition start where those of the previous partition end
+  std::vector<size_t> partition_offsets(partition_count);
+  auto group_count = size_t{0};
+  for (size_t partition_id = 0; partition_id < partition_count; ++partition_id) {
+    partition_offsets[partition_id] = group_count;
+    group_count += partition_group_keys[partition_id].size();
+  }
+
+  group_keys.resize(group_count);
+  std::vector<std::unique_ptr<BaseAggregateStates>> states;
+  for (const auto& aggregator : aggregators) states.push_back(aggregator->make_states(group_count));
+
+  jobs.clear();
+  for (size_t partition_id = 0; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      const auto partition_offset = partition_offsets[partition_id];
+      std::move(partition_group_keys[partition_id].begin(), partition_group_keys[partition_id].end(),
+                group_keys.begin() + partition_offset);
+
+      std::vector<size_t> target_group_ids;
+      for (size_t chunk_id = 0; chunk_id < partial_aggregates.size(); ++chunk_id) {
+        if (partitioned_group_ids[chunk_id].empty()) continue;
+
+        const auto& source_group_ids = partitioned_group_ids[chunk_id][partition_id];
+        target_group_ids.clear();
+        for (const auto group_id : source_group_ids) {
+          target_group_ids.push_back(partition_offset + group_mappings[chunk_id][group_id]);
+        }
+        for (size_t aggregate_id = 0; aggregate_id < aggregators.size(); ++aggregate_id) {
+          aggregators[aggregate_id]->merge(*partial_aggregates[chunk_id].states[aggregate_id], source_group_ids,
+                                           target_group_ids, *states[aggregate_id]);
+        }
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  aggregate_columns.resize(aggregators.size());
+  jobs.clear();
+  for (size_t aggregate_id = 0; aggregate_id < aggregators.size(); ++aggregate_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, aggregate_id]() {
+      aggregate_columns[aggregate_id] = aggregators[aggregate_id]->make_output_column(*states[aggregate_id]);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+}
+
+}  // namespace
+
+Aggregate::Aggregate(const std::shared_ptr<const AbstractOperator> in,
+                     const std::vector<AggregateDefinition>& aggregates,
+                     const std::vector<ColumnID>& groupby_column_ids)
+    : AbstractOperator(in), _aggregates(aggregates), _groupby_column_ids(groupby_column_ids) {}
+
+const std::vector<AggregateDefinition>& Aggregate::aggregates() const { return this->_aggregates; }
+
+const std::vector<ColumnID>& Aggregate::groupby_column_ids() const { return this->_groupby_column_ids; }
+
+std::shared_ptr<const Table> Aggregate::_on_execute() {
+  const auto input_table = this->_input_table_left();
+
+  std::vector<std::unique_ptr<BaseAggregator>> aggregators;
+  for (const auto& definition : this->_aggregates) {
+    const auto& column_type = input_table->column_type(definition.column_id);
+    aggregators.push_back(
+        make_unique_by_column_type<BaseAggregator, Aggregator>(column_type, definition.function, column_type));
+  }
+
+  std::vector<std::shared_ptr<BaseColumn>> groupby_columns(this->_groupby_column_ids.size());
+  std::vector<std::shared_ptr<BaseColumn>> aggregate_columns;
+
+  if (this->_groupby_column_ids.size() == 1) {
+    // a single group by column is hashed by its values, which saves building a key string for every row
+    const auto column_id = this->_groupby_column_ids.front();
+    resolve_data_type(input_table->column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+
+      const auto make_row_keys = [&](const Chunk& chunk) {
+        std::vector<Type> row_keys;
+        row_keys.reserve(chunk.size());
+        for_each_value_or_null<Type>(
+            *chunk.get_column(column_id), [&](const Type& value, const ChunkOffset) { row_keys.push_back(value); },
+            [](const ChunkOffset) { Fail("Aggregate does not support NULL values in group by columns"); });
+        return row_keys;
+      };
+
+      std::vector<Type> group_keys;
+      aggregate_groups<Type>(*input_table, this->_aggregates, aggregators, make_row_keys, group_keys,
+                             aggregate_columns);
+      groupby_columns.front() = std::make_shared<ValueColumn<Type>>(std::move(group_keys));
+    });
+  } else {
+    const auto make_row_keys = [&](const Chunk& chunk) {
+      std::vector<std::string> row_keys(chunk.size());
+      for (const auto& column_id : this->_groupby_column_ids) {
+        resolve_data_type(input_table->column_type(column_id), [&](auto type) {
+          using Type = typename decltype(type)::type;
+          // a NULL would add nothing to the key and shift the values of the following columns
+          for_each_value_or_null<Type>(
+              *chunk.get_column(column_id),
+              [&](const Type& value, const ChunkOffset offset) { append_normalized_key(row_keys[offset], value); },
+              [](const ChunkOffset) { Fail("Aggregate does not support NULL values in group by columns"); });
+        });
+      }
+      return row_keys;
+    };
+
+    std::vector<std::string> group_keys;
+    aggregate_groups<std::string>(*input_table, this->_aggregates, aggregators, make_row_keys, group_keys,
+                                  aggregate_columns);
+
+    // the values of the group by columns are decoded from the group keys
+    std::vector<size_t> key_positions(group_keys.size());
+    for (size_t groupby_id = 0; groupby_id < this->_groupby_column_ids.size(); ++groupby_id) {
+      resolve_data_type(input_table->column_type(this->_groupby_column_ids[groupby_id]), [&](auto type) {
+        using Type = typename decltype(type)::type;
+        std::vector<Type> values(group_keys.size());
+        for (size_t group_id = 0; group_id < group_keys.size(); ++group_id) {
+          values[group_id] = read_normalized_key<Type>(group_keys[group_id], key_positions[group_id]);
+        }
+        groupby_columns[groupby_id] = std::make_shared<ValueColumn<Type>>(std::move(values));
+      });
+    }
+  }
+
+  auto output_table = std::make_shared<Table>();
+  for (const auto& column_id : this->_groupby_column_ids) {
+    output_table->add_column(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  for (size_t aggregate_id = 0; aggregate_id < aggregators.size(); ++aggregate_id) {
+    const auto& definition = this->_aggregates[aggregate_id];
+    const auto name =
+        aggregate_function_name(definition.function) + "(" + input_table->column_name(definition.column_id) + ")";
+    output_table->add_column(name, aggregators[aggregate_id]->output_type());
+  }
+
+  auto output_columns = std::move(groupby_columns);
+  output_columns.insert(output_columns.end(), aggregate_columns.cbegin(), aggregate_columns.cend());
+  output_table->append_column_batch(output_columns);
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class AggregateFunction {
+  Count,
+  Sum,
+  Min,
+  Max,
+  Avg
+};
+
+struct AggregateDefinition {
+  ColumnID column_id;
+  AggregateFunction function;
+};
+
+// Aggregate groups the input by the values of the group by columns and computes the aggregates for each group.
+// Each chunk is aggregated by its own job into a partial hash table. The partial results are then partitioned by the
+// hash of their group keys, and each partition is merged by its own job.
+// A single group by column is hashed by its values. Keys of several group by columns are stored as normalized keys
+// (see normalized_key.hpp), so that any combination of column types is hashed and compared as one binary string.
+//
+// The output has one row per group, with the group by columns first, followed by one column per aggregate, which is
+// named like "SUM(column)". COUNT returns a long, SUM a long for integer columns and a double for floating point
+// columns, MIN and MAX the type of their column, and AVG a double. SUM and AVG are not defined for strings.
+// Without group by columns, the whole input forms a single group (and an empty input none at all).
+// Values that a ReferenceColumn refers to with NULL_ROW_ID are ignored by the aggregates. In the group by columns,
+// they make the operator fail, as the output columns cannot hold NULLs. For the same reason, MIN, MAX and AVG fail for
+// a group whose values are all NULL, while COUNT returns 0 and SUM returns 0 for it.
+// The order of the groups is not specified.
+class Aggregate : public AbstractOperator {
+ public:
+  Aggregate(const std::shared_ptr<const AbstractOperator> in, const std::vector<AggregateDefinition>& aggregates,
+            const std::vector<ColumnID>& groupby_column_ids);
+
+  const std::vector<AggregateDefinition>& aggregates() const;
+  const std::vector<ColumnID>& groupby_column_ids() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<AggregateDefinition> _aggregates;
+  const std::vector<ColumnID> _groupby_column_ids;
+};
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#include "binary_format.hpp"
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+#include "utils/memory_mapped_file.hpp"
+
+namespace opossum {
+
+BinaryWriter::BinaryWriter(const std::string& filename) : _file(filename) {}
+
+void BinaryWriter::write_string(const std::string& string) {
+  this->write(static_cast<uint32_t>(string.size()));
+  this->_write(string.data(), string.size());
+}
+
+void BinaryWriter::begin_array() {
+  static constexpr char padding[BINARY_ALIGNMENT] = {};
+  this->_write(padding, (BINARY_ALIGNMENT - this->_position % BINARY_ALIGNMENT) % BINARY_ALIGNMENT);
+}
+
+void BinaryWriter::flush() { this->_file.flush(); }
+
+BinaryReader::BinaryReader(const std::string& filename, const bool memory_map) {
+  if (memory_map) {
+    const auto mapping = std::make_shared<const MemoryMappedFile>(filename);
+    this->_mapping = mapping;
+    this->_mapped_data = mapping->data();
+    this->_mapped_size = mapping->size();
+  } else {
+    this->_stream.open(filename, std::ios::binary);
+    Assert(this->_stream.is_open(), "Cannot open " + filename + " for reading");
+  }
+}
+
+std::shared_ptr<const void> BinaryReader::mapping() const { return this->_mapping; }
+
+std::string BinaryReader::read_string() {
+  std::string string(this->read<uint32_t>(), '\0');
+  this->_read(&string[0], string.size());
+  return string;
+}
+
+void BinaryReader::_read(void* data, const size_t size) {
+  if (this->_mapping) {
+    const auto source = this->_mapped_data + this->_position;
+    this->_skip(size);
+    if (size > 0) std::memcpy(data, source, size);
+    return;
+  }
+
+  this->_stream.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+  Assert(this->_stream.good(), "Unexpected end of the binary file");
+  this->_position += size;
+}
+
+void BinaryReader::_skip(const size_t size) {
+  DebugAssert(this->_mapping != nullptr, "Only memory-mapped files can be skipped through");
+  Assert(size <= this->_mapped_size - this->_position, "Unexpected end of the binary file");
+  this->_position += size;
+}
+
+void BinaryReader::_align() {
+  const auto padding_size = (BINARY_ALIGNMENT - this->_position % BINARY_ALIGNMENT) % BINARY_ALIGNMENT;
+  if (this->_mapping) {
+    this->_skip(padding_size);
+  } else {
+    char padding[BINARY_ALIGNMENT];
+    this->_read(padding, padding_size);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "utils/buffered_file_writer.hpp"
+
+namespace opossum {
+
+/**
+ * The binary table format of ExportBinary and ImportBinary stores a table chunk by chunk and column by column, in
+ * the native byte order. Encoded columns are stored as they are, so that loading a table only copies arrays.
+ *
+ *   header:     magic "OPOSSUMT" (string), version (uint32), chunk_size (uint32), chunk_count (uint32),
+ *               column_count (uint16), and for each column its type and name (strings)
+ *   chunk:      row_count (uint32), followed by its columns. Empty chunks are not stored
+ *   column:     encoding (uint8, see BinaryColumnEncoding), followed by
+ *                - for ValueColumns: the values (row_count of them)
+ *                - for DictionaryColumns: dictionary_size (uint32), the dictionary values, the width of the
+ *                  attribute vector (uint8), and the attribute vector. Widths of 8, 16, and 32 bits are stored as
+ *                  arrays of uint8_t, uint16_t, or uint32_t, all others as the words of a BitPackedAttributeVector
+ *   values:     for numbers, an array of them. For strings, an array of their lengths (uint32) followed by an
+ *               array of their characters
+ *   string:     length (uint32) followed by the characters
+ *
+ * Every array starts at a file offset that is a multiple of BINARY_ALIGNMENT, so that it can be used in place once
+ * the file is in memory. ReferenceColumns are stored as ValueColumns of the values they reference.
+ */
+constexpr auto BINARY_MAGIC = "OPOSSUMT";
+constexpr auto BINARY_VERSION = uint32_t{1};
+constexpr auto BINARY_ALIGNMENT = size_t{8};
+
+enum class BinaryColumnEncoding : uint8_t { Value = 0, Dictionary = 1 };
+
+// BinaryWriter writes the parts of the binary format to a file through a BufferedFileWriter. Call flush() once the
+// table is written
+class BinaryWriter {
+ public:
+  explicit BinaryWriter(const std::string& filename);
+
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written");
+    this->_write(&value, sizeof(T));
+  }
+
+  void write_string(const std::string& string);
+
+  // writes an aligned array
+  template <typename T>
+  void write_array(const T* data, const size_t count) {
+    this->begin_array();
+    this->write_array_part(data, count);
+  }
+
+  // starts an aligned array whose elements are then written in parts, e.g., one at a time while they are produced
+  void begin_array();
+
+  template <typename T>
+  void write_array_part(const T* data, const size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written");
+    this->_write(data, count * sizeof(T));
+  }
+
+  // writes an aligned array of the values, which are numbers or strings
+  template <typename T>
+  void write_values(const T* values, const size_t count) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      std::vector<uint32_t> lengths;
+      lengths.reserve(count);
+      for (size_t index = 0; index < count; ++index) lengths.push_back(static_cast<uint32_t>(values[index].size()));
+      this->write_array(lengths.data(), lengths.size());
+
+      // the characters are written string by string instead of being copied into a single array first
+      this->begin_array();
+      for (size_t index = 0; index < count; ++index) this->write_array_part(values[index].data(), values[index].size());
+    } else {
+      this->write_array(values, count);
+    }
+  }
+
+  void flush();
+
+ protected:
+  void _write(const void* data, const size_t size) {
+    this->_file.write(data, size);
+    this->_position += size;
+  }
+
+  BufferedFileWriter _file;
+  size_t _position = 0;
+};
+
+// BinaryReader reads the parts of the binary format from a file, either through a stream or from a read-only memory
+// mapping of the whole file. The latter allows using arrays in place (see map_array()), in which case the pages of
+// the file are only read when they are accessed and can be shared by all processes that map the file.
+class BinaryReader {
+ public:
+  explicit BinaryReader(const std::string& filename, const bool memory_map = false);
+
+  template <typename T>
+  T read() {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read");
+    T value;
+    this->_read(&value, sizeof(T));
+    return value;
+  }
+
+  std::string read_string();
+
+  // reads an aligned array of the given number of elements into a std::vector or a pmr_vector
+  template <typename T, typename Vector = std::vector<T>>
+  Vector read_array(const size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read");
+    this->_align();
+    Vector array(count);
+    this->_read(array.data(), count * sizeof(T));
+    return array;
+  }
+
+  // returns a pointer to an aligned array of the given number of elements within the memory mapping, which the
+  // owner returned by mapping() keeps alive, instead of copying it
+  template <typename T>
+  const T* map_array(const size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be mapped");
+    this->_align();
+    const auto array = reinterpret_cast<const T*>(this->_mapped_data + this->_position);
+    this->_skip(count * sizeof(T));
+    return array;
+  }
+
+  // returns the owner of the memory mapping, nullptr if the file is read through a stream
+  std::shared_ptr<const void> mapping() const;
+
+  // reads an aligned array of the given number of values, which are numbers or strings
+  template <typename T, typename Vector = std::vector<T>>
+  Vector read_values(const size_t count) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto lengths = this->read_array<uint32_t>(count);
+      auto characters_count = size_t{0};
+      for (const auto length : lengths) characters_count += length;
+      const auto characters = this->read_array<char>(characters_count);
+
+      Vector values;
+      values.reserve(count);
+      auto position = characters.data();
+      for (const auto length : lengths) {
+        values.emplace_back(position, length);
+        position += length;
+      }
+      return values;
+    } else {
+      return this->read_array<T, Vector>(count);
+    }
+  }
+
+ protected:
+  void _read(void* data, const size_t size);
+  // moves the position of a memory-mapped file by the given number of bytes
+  void _skip(const size_t size);
+  void _align();
+
+  std::ifstream _stream;
+  size_t _position = 0;
+
+  std::shared_ptr<const void> _mapping;
+  const char* _mapped_data = nullptr;
+  size_t _mapped_size = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,152 @@
+#include "csv_format.hpp"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns a bit mask of the bytes of the block at data that equal one of the two characters. The block size depends
+// on the instruction set (see SPECIAL_CHARACTERS_BLOCK_SIZE).
+#if defined(__AVX2__)
+
+constexpr auto SPECIAL_CHARACTERS_BLOCK_SIZE = size_t{32};
+
+uint32_t special_characters_mask(const char* data, const char first, const char second) {
+  const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  const auto matches = _mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(first)),
+                                       _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(second)));
+  return static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+}
+
+#elif defined(__SSE2__)
+
+constexpr auto SPECIAL_CHARACTERS_BLOCK_SIZE = size_t{16};
+
+uint32_t special_characters_mask(const char* data, const char first, const char second) {
+  const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  const auto matches =
+      _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(first)), _mm_cmpeq_epi8(bytes, _mm_set1_epi8(second)));
+  return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+}
+
+#else
+
+constexpr auto SPECIAL_CHARACTERS_BLOCK_SIZE = size_t{8};
+
+uint32_t special_characters_mask(const char* data, const char first, const char second) {
+  auto mask = uint32_t{0};
+  for (size_t index = 0; index < SPECIAL_CHARACTERS_BLOCK_SIZE; ++index) {
+    mask |= static_cast<uint32_t>(data[index] == first || data[index] == second) << index;
+  }
+  return mask;
+}
+
+#endif
+
+// splits a line of the meta file, whose fields are never quoted
+std::vector<std::string> split_meta_line(const std::string& line) {
+  std::vector<std::string> fields;
+  auto begin = size_t{0};
+  while (true) {
+    const auto end = line.find(CSV_DELIMITER, begin);
+    fields.push_back(line.substr(begin, end == std::string::npos ? std::string::npos : end - begin));
+    if (end == std::string::npos) return fields;
+    begin = end + 1;
+  }
+}
+
+}  // namespace
+
+CsvMeta read_csv_meta(const std::string& filename) {
+  const auto meta_filename = filename + CSV_META_SUFFIX;
+  std::ifstream stream(meta_filename);
+  Assert(stream.is_open(), "Cannot open " + meta_filename);
+
+  CsvMeta meta;
+  std::string line;
+  std::getline(stream, line);
+  while (std::getline(stream, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.empty()) continue;
+
+    const auto fields = split_meta_line(line);
+    Assert(fields.size() == 3, "Invalid line in " + meta_filename + ": " + line);
+    if (fields[0] == "ChunkSize") {
+      meta.chunk_size = static_cast<uint32_t>(std::stoul(fields[2]));
+    } else if (fields[0] == "ColumnType") {
+      meta.column_names.push_back(fields[1]);
+      meta.column_types.push_back(fields[2]);
+    } else {
+      Fail("Unknown property type in " + meta_filename + ": " + fields[0]);
+    }
+  }
+  return meta;
+}
+
+void write_csv_meta(const std::string& filename, const CsvMeta& meta) {
+  const auto meta_filename = filename + CSV_META_SUFFIX;
+  std::ofstream stream(meta_filename);
+  Assert(stream.is_open(), "Cannot open " + meta_filename + " for writing");
+
+  stream << "PropertyType,Key,Value\n";
+  stream << "ChunkSize,," << meta.chunk_size << "\n";
+  for (size_t column_index = 0; column_index < meta.column_names.size(); ++column_index) {
+    stream << "ColumnType," << meta.column_names[column_index] << "," << meta.column_types[column_index] << "\n";
+  }
+  Assert(stream.good(), "Writing " + meta_filename + " failed");
+}
+
+std::vector<size_t> find_csv_ranges(const char* data, const size_t size, const size_t rows_per_range) {
+  DebugAssert(rows_per_range > 0, "Ranges need at least one row");
+
+  std::vector<size_t> boundaries{0};
+  auto in_quotes = false;
+  auto rows_in_range = size_t{0};
+
+  // called for every quote and line break. Escaped quotes ("") toggle twice and thus do not change the state
+  const auto handle_special_character = [&](const size_t position) {
+    if (data[position] == CSV_QUOTE) {
+      in_quotes = !in_quotes;
+    } else if (!in_quotes && ++rows_in_range == rows_per_range && position + 1 < size) {
+      boundaries.push_back(position + 1);
+      rows_in_range = 0;
+    }
+  };
+
+  auto position = size_t{0};
+  for (; position + SPECIAL_CHARACTERS_BLOCK_SIZE <= size; position += SPECIAL_CHARACTERS_BLOCK_SIZE) {
+    auto mask = special_characters_mask(data + position, CSV_QUOTE, '\n');
+    while (mask) {
+      handle_special_character(position + __builtin_ctz(mask));
+      mask &= mask - 1;
+    }
+  }
+  for (; position < size; ++position) {
+    if (data[position] == CSV_QUOTE || data[position] == '\n') handle_special_character(position);
+  }
+
+  Assert(!in_quotes, "CSV data ends within a quoted field");
+  if (size > 0) boundaries.push_back(size);
+  return boundaries;
+}
+
+const char* find_csv_field_end(const char* begin, const char* end) {
+  auto position = begin;
+  for (; position + SPECIAL_CHARACTERS_BLOCK_SIZE <= end; position += SPECIAL_CHARACTERS_BLOCK_SIZE) {
+    const auto mask = special_characters_mask(position, CSV_DELIMITER, '\n');
+    if (mask) return position + __builtin_ctz(mask);
+  }
+  while (position < end && *position != CSV_DELIMITER && *position != '\n') ++position;
+  return position;
+}
+
+}  // namespace opossum
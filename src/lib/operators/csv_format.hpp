@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * The CSV files of ImportCsv and ExportCsv follow RFC 4180: fields are separated by commas and rows by line breaks
+ * (\n or \r\n). Fields that contain a comma, a quote, or a line break are enclosed in quotes, and quotes within them
+ * are doubled. The files have no header line. Instead, the chunk size and the column names and types are stored in
+ * a meta file next to the data (filename + CSV_META_SUFFIX), which is a CSV file itself:
+ *
+ *   PropertyType,Key,Value
+ *   ChunkSize,,100
+ *   ColumnType,a,int
+ *   ColumnType,b,string
+ */
+constexpr auto CSV_DELIMITER = ',';
+constexpr auto CSV_QUOTE = '"';
+constexpr auto CSV_META_SUFFIX = ".meta";
+
+struct CsvMeta {
+  uint32_t chunk_size = 0;
+  std::vector<std::string> column_names;
+  std::vector<std::string> column_types;
+};
+
+// reads the meta file of the given CSV file
+CsvMeta read_csv_meta(const std::string& filename);
+
+// writes the meta file of the given CSV file
+void write_csv_meta(const std::string& filename, const CsvMeta& meta);
+
+// Returns the offsets of every rows_per_range-th row of the CSV data, starting with 0 and followed by the size of
+// the data, i.e., the boundaries of byte ranges that hold rows_per_range rows each (the last one possibly fewer).
+// Line breaks within quoted fields do not end rows. The data is searched for quotes and line breaks a block of 16 or
+// 32 bytes at a time using SIMD instructions, so that blocks without either are skipped with one comparison.
+std::vector<size_t> find_csv_ranges(const char* data, const size_t size, const size_t rows_per_range);
+
+// returns the first delimiter or line break in [begin, end), or end, searching the same way
+const char* find_csv_field_end(const char* begin, const char* end);
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#include "export_binary.hpp"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "binary_format.hpp"
+#include "resolve_type.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/for_each_value.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+void export_dictionary_column(const DictionaryColumn<T>& column, BinaryWriter& writer) {
+  writer.write(BinaryColumnEncoding::Dictionary);
+  writer.write(static_cast<uint32_t>(column.unique_values_count()));
+  writer.write_values(column.dictionary()->data(), column.dictionary()->size());
+
+  resolve_attribute_vector(*column.attribute_vector(), [&](const auto& attribute_vector) {
+    using AttributeVector = std::decay_t<decltype(attribute_vector)>;
+    writer.write(attribute_vector.width());
+    if constexpr (std::is_same_v<AttributeVector, BitPackedAttributeVector>) {
+      writer.write_array(attribute_vector.words().data(), attribute_vector.words().size());
+    } else {
+      writer.write_array(attribute_vector.values().data(), attribute_vector.values().size());
+    }
+  });
+}
+
+// Writes the values that a ReferenceColumn references as a ValueColumn. They are written one at a time through the
+// writer's buffer instead of being collected first, as a single chunk of ReferenceColumns, e.g., the output of a Sort,
+// may span the whole table. The lengths and the characters of strings are written in two passes over the column.
+template <typename T>
+void export_referenced_values(const ReferenceColumn& column, BinaryWriter& writer) {
+  writer.write(BinaryColumnEncoding::Value);
+  writer.begin_array();
+
+  auto value_count = size_t{0};
+  if constexpr (std::is_same_v<T, std::string>) {
+    for_each_value<T>(column, [&](const T& value, const ChunkOffset) {
+      const auto length = static_cast<uint32_t>(value.size());
+      writer.write_array_part(&length, 1);
+      ++value_count;
+    });
+    writer.begin_array();
+    for_each_value<T>(column,
+                      [&](const T& value, const ChunkOffset) { writer.write_array_part(value.data(), value.size()); });
+  } else {
+    for_each_value<T>(column, [&](const T& value, const ChunkOffset) {
+      writer.write_array_part(&value, 1);
+      ++value_count;
+    });
+  }
+  Assert(value_count == column.size(), "ExportBinary does not support NULL values");
+}
+
+template <typename T>
+void export_column(hana::basic_type<T>, const BaseColumn& column, BinaryWriter& writer) {
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    writer.write(BinaryColumnEncoding::Value);
+    writer.write_values(value_column->data(), value_column->size());
+  } else if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    export_dictionary_column(*dictionary_column, writer);
+  } else if (const auto reference_column = dynamic_cast<const ReferenceColumn*>(&column)) {
+    export_referenced_values<T>(*reference_column, writer);
+  } else {
+    Fail("Unsupported column type");
+  }
+}
+
+}  // namespace
+
+ExportBinary::ExportBinary(const std::shared_ptr<const AbstractOperator> in, const std::string& filename)
+    : AbstractOperator(in), _filename(filename) {}
+
+std::shared_ptr<const Table> ExportBinary::_on_execute() {
+  const auto table = this->_input_table_left();
+  BinaryWriter writer(this->_filename);
+
+  // empty chunks, e.g., the last chunk of a table that was just compressed, are left out
+  auto chunk_count = uint32_t{0};
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    if (table->get_chunk(chunk_id).size() > 0) ++chunk_count;
+  }
+
+  writer.write_string(BINARY_MAGIC);
+  writer.write(BINARY_VERSION);
+  writer.write(table->chunk_size());
+  writer.write(chunk_count);
+  writer.write(static_cast<uint16_t>(table->column_names().size()));
+  for (ColumnID column_id{0}; column_id < table->column_names().size(); ++column_id) {
+    writer.write_string(table->column_type(column_id));
+    writer.write_string(table->column_name(column_id));
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    writer.write(chunk.size());
+    for (ColumnID column_id{0}; column_id < table->column_names().size(); ++column_id) {
+      resolve_data_type(table->column_type(column_id),
+                        [&](auto type) { export_column(type, *chunk.get_column(column_id), writer); });
+    }
+  }
+  writer.flush();
+
+  return table;
+}
+
+}  // namespace opossum
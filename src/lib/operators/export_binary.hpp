@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// ExportBinary writes its input table to a file in the binary format described in binary_format.hpp, from which
+// ImportBinary loads it again. Value and dictionary columns are written as they are, so that neither exporting nor
+// importing needs to look at single values (except for strings). The output is the input table.
+class ExportBinary : public AbstractOperator {
+ public:
+  ExportBinary(const std::shared_ptr<const AbstractOperator> in, const std::string& filename);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _filename;
+};
+
+}  // namespace opossum
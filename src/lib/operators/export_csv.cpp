@@ -0,0 +1,153 @@
+#include "export_csv.hpp"
+
+#include <charconv>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "csv_format.hpp"
+#include "resolve_type.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/buffered_file_writer.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+void write_csv_field(const T& value, BufferedFileWriter& writer) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (value.find_first_of("\",\r\n") == std::string::npos) {
+      writer.write(value.data(), value.size());
+      return;
+    }
+
+    // the field is quoted, and its quotes are doubled
+    writer.write(&CSV_QUOTE, 1);
+    auto begin = size_t{0};
+    for (auto quote = value.find(CSV_QUOTE); quote != std::string::npos; quote = value.find(CSV_QUOTE, begin)) {
+      writer.write(value.data() + begin, quote + 1 - begin);
+      writer.write(&CSV_QUOTE, 1);
+      begin = quote + 1;
+    }
+    writer.write(value.data() + begin, value.size() - begin);
+    writer.write(&CSV_QUOTE, 1);
+  } else {
+    // to_chars writes the shortest representation that is parsed back to the same value
+    char buffer[32];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    DebugAssert(result.ec == std::errc(), "Formatting a value failed");
+    writer.write(buffer, result.ptr - buffer);
+  }
+}
+
+class BaseCsvColumnWriter {
+ public:
+  virtual ~BaseCsvColumnWriter() = default;
+
+  // writes the value at the given offset of the column
+  virtual void write(const ChunkOffset chunk_offset, BufferedFileWriter& writer) = 0;
+};
+
+// Writes the values of a ValueColumn, DictionaryColumn, or ReferenceColumn of type T by their offset, so that the
+// columns of a chunk can be written row by row. Like for_each_value, it does not construct AllTypeVariants.
+template <typename T>
+class CsvColumnWriter : public BaseCsvColumnWriter {
+ public:
+  explicit CsvColumnWriter(const BaseColumn& column) {
+    if (!this->_resolve(column)) {
+      this->_reference_column = dynamic_cast<const ReferenceColumn*>(&column);
+      Assert(this->_reference_column, "Unsupported column type");
+    }
+  }
+
+  void write(const ChunkOffset chunk_offset, BufferedFileWriter& writer) override {
+    if (!this->_reference_column) {
+      this->_write(chunk_offset, writer);
+      return;
+    }
+
+    const auto& row_id = (*this->_reference_column->pos_list())[chunk_offset];
+    Assert(!(row_id == NULL_ROW_ID), "ExportCsv does not support NULL values");
+
+    // the referenced column is only looked up when the referenced chunk changes
+    if (row_id.chunk_id != this->_referenced_chunk_id) {
+      this->_referenced_chunk_id = row_id.chunk_id;
+      const auto& referenced_table = *this->_reference_column->referenced_table();
+      const auto& referenced_column = *referenced_table.get_chunk(row_id.chunk_id)
+                                           .get_column(this->_reference_column->referenced_column_id());
+      Assert(this->_resolve(referenced_column), "Unsupported referenced column type");
+    }
+    this->_write(row_id.chunk_offset, writer);
+  }
+
+ protected:
+  // sets the value or dictionary column to read from, returns false if the column is neither
+  bool _resolve(const BaseColumn& column) {
+    this->_value_column = dynamic_cast<const ValueColumn<T>*>(&column);
+    this->_dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column);
+    return this->_value_column || this->_dictionary_column;
+  }
+
+  void _write(const ChunkOffset chunk_offset, BufferedFileWriter& writer) const {
+    if (this->_value_column) {
+      write_csv_field(this->_value_column->get_typed(chunk_offset), writer);
+    } else {
+      const auto& dictionary = *this->_dictionary_column->dictionary();
+      write_csv_field(dictionary[this->_dictionary_column->attribute_vector()->get(chunk_offset)], writer);
+    }
+  }
+
+  const ValueColumn<T>* _value_column = nullptr;
+  const DictionaryColumn<T>* _dictionary_column = nullptr;
+  const ReferenceColumn* _reference_column = nullptr;
+  ChunkID _referenced_chunk_id = INVALID_CHUNK_ID;
+};
+
+}  // namespace
+
+ExportCsv::ExportCsv(const std::shared_ptr<const AbstractOperator> in, const std::string& filename)
+    : AbstractOperator(in), _filename(filename) {}
+
+std::shared_ptr<const Table> ExportCsv::_on_execute() {
+  const auto table = this->_input_table_left();
+  const auto column_count = table->column_names().size();
+
+  CsvMeta meta;
+  meta.chunk_size = table->chunk_size();
+  meta.column_names = table->column_names();
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    meta.column_types.push_back(table->column_type(column_id));
+  }
+  write_csv_meta(this->_filename, meta);
+
+  BufferedFileWriter writer(this->_filename);
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    std::vector<std::unique_ptr<BaseCsvColumnWriter>> column_writers;
+    for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+      column_writers.push_back(make_unique_by_column_type<BaseCsvColumnWriter, CsvColumnWriter>(
+          table->column_type(column_id), *chunk.get_column(column_id)));
+    }
+
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+        if (column_id > 0) writer.write(&CSV_DELIMITER, 1);
+        column_writers[column_id]->write(chunk_offset, writer);
+      }
+      writer.write("\n", 1);
+    }
+  }
+  writer.flush();
+
+  return table;
+}
+
+}  // namespace opossum
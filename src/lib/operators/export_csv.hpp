@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// ExportCsv writes its input table to a CSV file and its meta file (see csv_format.hpp), from which ImportCsv loads
+// it again. The rows are written chunk by chunk through a BufferedFileWriter, and each field is formatted straight
+// from its typed column, so that exporting holds neither the table as AllTypeVariants nor the text of more than the
+// buffer in memory. NULL values are not supported, as ImportCsv could not tell them from empty strings or read them
+// as numbers. The output is the input table.
+class ExportCsv : public AbstractOperator {
+ public:
+  ExportCsv(const std::shared_ptr<const AbstractOperator> in, const std::string& filename);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _filename;
+};
+
+}  // namespace opossum
@@ -0,0 +1,121 @@
+#include "import_binary.hpp"
+
+#include <optional>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "binary_format.hpp"
+#include "resolve_type.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::shared_ptr<BaseAttributeVector> import_attribute_vector(BinaryReader& reader, const size_t row_count) {
+  const auto width = reader.read<AttributeVectorWidth>();
+  switch (width) {
+    case 8:
+      return std::make_shared<FixedSizeAttributeVector<uint8_t>>(reader.read_array<uint8_t>(row_count));
+    case 16:
+      return std::make_shared<FixedSizeAttributeVector<uint16_t>>(reader.read_array<uint16_t>(row_count));
+    case 32:
+      return std::make_shared<FixedSizeAttributeVector<uint32_t>>(reader.read_array<uint32_t>(row_count));
+    default:
+      // see the BitPackedAttributeVector constructor for the number of words
+      auto words = reader.read_array<uint64_t>((row_count * width + 63) / 64 + 1);
+      return std::make_shared<BitPackedAttributeVector>(row_count, width, std::move(words));
+  }
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> import_column(hana::basic_type<T>, BinaryReader& reader, const size_t row_count) {
+  const auto encoding = reader.read<BinaryColumnEncoding>();
+  switch (encoding) {
+    case BinaryColumnEncoding::Value:
+      if constexpr (!std::is_same_v<T, std::string>) {
+        if (reader.mapping()) {
+          return std::make_shared<ValueColumn<T>>(reader.map_array<T>(row_count), row_count, reader.mapping());
+        }
+      }
+      return std::make_shared<ValueColumn<T>>(reader.read_values<T, pmr_vector<T>>(row_count));
+    case BinaryColumnEncoding::Dictionary: {
+      const auto dictionary_size = reader.read<uint32_t>();
+      auto dictionary = std::make_shared<std::vector<T>>(reader.read_values<T>(dictionary_size));
+      return std::make_shared<DictionaryColumn<T>>(std::move(dictionary), import_attribute_vector(reader, row_count));
+    }
+  }
+  Fail("Unknown column encoding in binary file");
+}
+
+}  // namespace
+
+ImportBinary::ImportBinary(const std::string& filename, const std::optional<std::string> tablename,
+                           const BinaryImportMode mode)
+    : _filename(filename), _tablename(tablename), _mode(mode) {}
+
+std::shared_ptr<const Table> ImportBinary::_on_execute() {
+  if (this->_tablename && StorageManager::get().has_table(*this->_tablename)) {
+    return StorageManager::get().get_table(*this->_tablename);
+  }
+
+  const auto memory_map = this->_mode == BinaryImportMode::MemoryMap;
+  BinaryReader reader(this->_filename, memory_map);
+  Assert(reader.read_string() == BINARY_MAGIC, this->_filename + " is not a binary table file");
+  Assert(reader.read<uint32_t>() == BINARY_VERSION, this->_filename + " has an unsupported version");
+
+  const auto chunk_size = reader.read<uint32_t>();
+  const auto chunk_count = reader.read<uint32_t>();
+  const auto column_count = reader.read<uint16_t>();
+
+  auto table = std::make_shared<Table>(chunk_size);
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    const auto type = reader.read_string();
+    const auto name = reader.read_string();
+    table->add_column(name, type);
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto row_count = reader.read<uint32_t>();
+
+    Chunk chunk;
+    for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(table->column_type(column_id),
+                        [&](auto type) { chunk.add_column(import_column(type, reader, row_count)); });
+    }
+    if (memory_map) {
+      table->emplace_chunk(std::move(chunk));
+    } else {
+      table->emplace_sealed_chunk(std::move(chunk));
+    }
+  }
+
+  // the loaded chunks are immutable or sealed, so further rows go into a new chunk
+  if (chunk_count > 0) {
+    if (memory_map) {
+      // create_new_chunk() would seal the last loaded chunk
+      Chunk chunk;
+      for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+        chunk.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(table->column_type(column_id)));
+      }
+      table->emplace_chunk(std::move(chunk));
+    } else {
+      table->create_new_chunk();
+    }
+  }
+
+  if (this->_tablename) StorageManager::get().add_table(*this->_tablename, table);
+  return table;
+}
+
+}  // namespace opossum
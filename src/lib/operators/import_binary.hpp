@@ -0,0 +1,40 @@
+#pragma once
+
+#include <optional>
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+enum class BinaryImportMode {
+  // the file is read into columns that own their values
+  Read,
+  // the file is mapped into memory, and ValueColumns of fixed-width types refer to their values in the mapping
+  // instead of copying them. Pages are only read when they are accessed and the page cache is shared by all
+  // processes that load the file. The mapping lives as long as any of these columns
+  MemoryMap
+};
+
+// ImportBinary loads a table that ExportBinary wrote (see binary_format.hpp). The chunks keep their encoding.
+// When reading the file, the chunks are sealed, i.e., they get their zone maps and are added to the table
+// statistics. Memory-mapped chunks are not sealed, as that would read all of their values. In both cases, appended
+// rows go into a new chunk.
+// If a table name is given, the table is added to the StorageManager under that name, or, if the StorageManager
+// already has a table of that name, that table is the output and the file is not read.
+class ImportBinary : public AbstractOperator {
+ public:
+  explicit ImportBinary(const std::string& filename, const std::optional<std::string> tablename = std::nullopt,
+                        const BinaryImportMode mode = BinaryImportMode::Read);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _filename;
+  const std::optional<std::string> _tablename;
+  const BinaryImportMode _mode;
+};
+
+}  // namespace opossum
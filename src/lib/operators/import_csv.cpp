@@ -0,0 +1,312 @@
+#include "import_csv.hpp"
+
+#include <charconv>
+#include <optional>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "csv_format.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/column_arena.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "storage/zone_map.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_mapped_file.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the number of rows per parsed range of tables with unlimited chunks, whose ranges are combined into one chunk
+constexpr auto ROWS_PER_RANGE_OF_UNLIMITED_CHUNKS = size_t{65536};
+
+// parses the field [begin, end) as a number of type T
+template <typename T>
+T parse_number(const char* begin, const char* end) {
+  auto value = T{};
+  if constexpr (std::is_integral_v<T>) {
+    const auto result = std::from_chars(begin, end, value);
+    Assert(result.ec == std::errc() && result.ptr == end, "Invalid value in CSV file: " + std::string(begin, end));
+  } else {
+    // libc++ implements from_chars for integers only. strtod needs a null-terminated string.
+    const auto field = std::string(begin, end);
+    char* field_end = nullptr;
+    errno = 0;
+    if constexpr (std::is_same_v<T, float>) {
+      value = std::strtof(field.c_str(), &field_end);
+    } else {
+      value = std::strtod(field.c_str(), &field_end);
+    }
+    Assert(!field.empty() && errno == 0 && field_end == field.c_str() + field.size(),
+           "Invalid value in CSV file: " + field);
+  }
+  return value;
+}
+
+// collects the values of one column of a range
+class BaseCsvColumnParser {
+ public:
+  virtual ~BaseCsvColumnParser() = default;
+
+  // parses the field [begin, end), whose quotes are already removed
+  virtual void parse(const char* begin, const char* end) = 0;
+
+  virtual size_t size() const = 0;
+
+  // moves the values into a ValueColumn
+  virtual std::shared_ptr<BaseColumn> make_column() = 0;
+};
+
+template <typename T>
+class CsvColumnParser : public BaseCsvColumnParser {
+ public:
+  CsvColumnParser(const size_t expected_row_count, std::shared_ptr<ColumnArena> arena)
+      : _arena(std::move(arena)), _values(this->_arena.get()) {
+    this->_values.reserve(expected_row_count);
+  }
+
+  void parse(const char* begin, const char* end) override {
+    if constexpr (std::is_same_v<T, std::string>) {
+      this->_values.emplace_back(begin, end);
+    } else {
+      this->_values.push_back(parse_number<T>(begin, end));
+    }
+  }
+
+  size_t size() const override { return this->_values.size(); }
+
+  std::shared_ptr<BaseColumn> make_column() override {
+    return std::make_shared<ValueColumn<T>>(std::move(this->_values), this->_arena);
+  }
+
+ protected:
+  std::shared_ptr<ColumnArena> _arena;
+  pmr_vector<T> _values;
+};
+
+using CsvColumnParsers = std::vector<std::unique_ptr<BaseCsvColumnParser>>;
+
+// Creates an arena that fits the values of row_count rows of all columns, so that the chunk that they become needs a
+// single allocation, and parallel jobs do not contend for the global allocator. Strings only keep their headers in
+// the arena.
+std::shared_ptr<ColumnArena> make_column_arena(const std::vector<std::string>& column_types, const size_t row_count) {
+  auto arena_size = size_t{0};
+  for (const auto& column_type : column_types) {
+    resolve_data_type(column_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+      arena_size += row_count * sizeof(Type) + alignof(Type);
+    });
+  }
+  return std::make_shared<ColumnArena>(arena_size);
+}
+
+// creates one parser per column, whose values are allocated from an arena that fits row_count rows
+CsvColumnParsers make_csv_column_parsers(const std::vector<std::string>& column_types, const size_t row_count) {
+  const auto arena = make_column_arena(column_types, row_count);
+
+  CsvColumnParsers parsers;
+  for (const auto& column_type : column_types) {
+    parsers.push_back(make_unique_by_column_type<BaseCsvColumnParser, CsvColumnParser>(column_type, row_count, arena));
+  }
+  return parsers;
+}
+
+// Parses the rows in [begin, end) into the parsers, one per column. Unquoted fields are handed to the parsers as they
+// are. Quoted fields are copied into a buffer without their quotes first, unless they contain no escaped quotes.
+void parse_csv_range(const char* begin, const char* end, CsvColumnParsers& parsers) {
+  std::string buffer;
+  auto position = begin;
+  while (position < end) {
+    for (size_t column_index = 0; column_index < parsers.size(); ++column_index) {
+      const char* field_begin;
+      const char* field_end;
+
+      if (position < end && *position == CSV_QUOTE) {
+        field_begin = position + 1;
+        field_end = field_begin;
+        buffer.clear();
+        auto escaped = false;
+        while (true) {
+          const auto quote = static_cast<const char*>(std::memchr(field_end, CSV_QUOTE, end - field_end));
+          Assert(quote, "CSV data ends within a quoted field");
+          if (quote + 1 < end && quote[1] == CSV_QUOTE) {
+            // an escaped quote: keep the first of both
+            buffer.append(field_end, quote + 1);
+            field_end = quote + 2;
+            escaped = true;
+            continue;
+          }
+          if (escaped) buffer.append(field_end, quote);
+          field_end = quote;
+          position = quote + 1;
+          break;
+        }
+        if (escaped) {
+          field_begin = buffer.data();
+          field_end = buffer.data() + buffer.size();
+        }
+      } else {
+        field_begin = position;
+        field_end = find_csv_field_end(position, end);
+        position = field_end;
+      }
+
+      const auto last_column = column_index + 1 == parsers.size();
+      if (last_column) {
+        // \r\n line breaks. The \r ends an unquoted field or follows the closing quote of a quoted one
+        if (field_end == position && field_end > field_begin && field_end[-1] == '\r') {
+          --field_end;
+        } else if (position < end && *position == '\r') {
+          ++position;
+        }
+        Assert(position == end || *position == '\n', "Too many fields in CSV row");
+      } else {
+        Assert(position < end && *position == CSV_DELIMITER, "Too few fields in CSV row");
+      }
+      ++position;
+
+      parsers[column_index]->parse(field_begin, field_end);
+    }
+  }
+}
+
+// Moves the values of the chunks, in this order, into one chunk of ValueColumns. Its columns are allocated at once, and
+// the values of each chunk are moved by a job of its own. The chunks are left without values.
+Chunk concatenate_chunks(std::vector<Chunk>& chunks, const std::vector<std::string>& column_types) {
+  std::vector<size_t> offsets(chunks.size() + 1);
+  for (size_t chunk_index = 0; chunk_index < chunks.size(); ++chunk_index) {
+    offsets[chunk_index + 1] = offsets[chunk_index] + chunks[chunk_index].size();
+  }
+  const auto row_count = offsets.back();
+
+  const auto arena = make_column_arena(column_types, row_count);
+  Chunk concatenated_chunk;
+  for (const auto& column_type : column_types) {
+    resolve_data_type(column_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+      concatenated_chunk.add_column(
+          std::make_shared<ValueColumn<Type>>(pmr_vector<Type>(row_count, arena.get()), arena));
+    });
+  }
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (size_t chunk_index = 0; chunk_index < chunks.size(); ++chunk_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_index]() {
+      for (ColumnID column_id{0}; column_id < column_types.size(); ++column_id) {
+        resolve_data_type(column_types[column_id], [&](auto type) {
+          using Type = typename decltype(type)::type;
+          auto& source_values =
+              std::static_pointer_cast<ValueColumn<Type>>(chunks[chunk_index].get_column(column_id))->values();
+          auto& target_values =
+              std::static_pointer_cast<ValueColumn<Type>>(concatenated_chunk.get_column(column_id))->values();
+          std::move(source_values.begin(), source_values.end(), target_values.begin() + offsets[chunk_index]);
+        });
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  return concatenated_chunk;
+}
+
+}  // namespace
+
+ImportCsv::ImportCsv(const std::string& filename, const std::optional<std::string> tablename)
+    : _filename(filename), _tablename(tablename) {}
+
+ImportCsv::ImportCsv(const std::string& filename, const std::shared_ptr<const Table> table_definition,
+                     const std::optional<std::string> tablename)
+    : _filename(filename), _table_definition(table_definition), _tablename(tablename) {
+  DebugAssert(table_definition, "ImportCsv needs a table definition");
+}
+
+std::shared_ptr<const Table> ImportCsv::_on_execute() {
+  if (this->_tablename && StorageManager::get().has_table(*this->_tablename)) {
+    return StorageManager::get().get_table(*this->_tablename);
+  }
+
+  CsvMeta meta;
+  if (this->_table_definition) {
+    meta.chunk_size = this->_table_definition->chunk_size();
+    meta.column_names = this->_table_definition->column_names();
+    // col_count() would be 0, as the definition has no columns yet
+    for (ColumnID column_id{0}; column_id < meta.column_names.size(); ++column_id) {
+      meta.column_types.push_back(this->_table_definition->column_type(column_id));
+    }
+  } else {
+    meta = read_csv_meta(this->_filename);
+  }
+  Assert(!meta.column_names.empty(), "CSV tables need at least one column");
+
+  auto table = std::make_shared<Table>(meta.chunk_size);
+  for (size_t column_index = 0; column_index < meta.column_names.size(); ++column_index) {
+    table->add_column(meta.column_names[column_index], meta.column_types[column_index]);
+  }
+
+  const MemoryMappedFile file(this->_filename);
+  const auto rows_per_range = meta.chunk_size > 0 ? size_t{meta.chunk_size} : ROWS_PER_RANGE_OF_UNLIMITED_CHUNKS;
+  const auto boundaries = find_csv_ranges(file.data(), file.size(), rows_per_range);
+  // an empty file has no ranges
+  const auto range_count = boundaries.size() - 1;
+
+  // Each job also seals the chunk of its range, i.e., computes its zone maps and statistics, so that adding the chunks
+  // to the table only merges their statistics.
+  std::vector<Chunk> range_chunks(range_count);
+  std::vector<TableStatistics> range_statistics(range_count);
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (size_t range_index = 0; range_index < range_count; ++range_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, range_index]() {
+      auto parsers = make_csv_column_parsers(meta.column_types, rows_per_range);
+      parse_csv_range(file.data() + boundaries[range_index], file.data() + boundaries[range_index + 1], parsers);
+
+      auto& chunk = range_chunks[range_index];
+      for (auto& parser : parsers) chunk.add_column(parser->make_column());
+      range_statistics[range_index] = table->seal_detached_chunk(chunk);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  if (meta.chunk_size == 0 && range_count > 1) {
+    // With unlimited chunks, all ranges form a single chunk. Its zone maps combine those of the ranges, and its
+    // statistics keep one histogram per range.
+    std::vector<std::optional<ZoneMap>> zone_maps;
+    for (ColumnID column_id{0}; column_id < meta.column_types.size(); ++column_id) {
+      std::vector<std::optional<ZoneMap>> range_zone_maps;
+      for (const auto& range_chunk : range_chunks) range_zone_maps.push_back(range_chunk.zone_map(column_id));
+      zone_maps.push_back(merge_zone_maps(range_zone_maps, meta.column_types[column_id]));
+    }
+
+    auto chunk = concatenate_chunks(range_chunks, meta.column_types);
+    chunk.set_zone_maps(std::move(zone_maps));
+    chunk.mark_as_sealed();
+    for (size_t range_index = 1; range_index < range_count; ++range_index) {
+      range_statistics.front().merge(std::move(range_statistics[range_index]));
+    }
+
+    range_chunks.clear();
+    range_chunks.push_back(std::move(chunk));
+    range_statistics.resize(1);
+  }
+
+  for (size_t chunk_index = 0; chunk_index < range_chunks.size(); ++chunk_index) {
+    table->emplace_sealed_chunk(std::move(range_chunks[chunk_index]), std::move(range_statistics[chunk_index]));
+  }
+  if (range_count > 0) table->create_new_chunk();
+
+  if (this->_tablename) StorageManager::get().add_table(*this->_tablename, table);
+  return table;
+}
+
+}  // namespace opossum
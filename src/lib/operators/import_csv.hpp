@@ -0,0 +1,36 @@
+#pragma once
+
+#include <optional>
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// ImportCsv loads a CSV file (see csv_format.hpp). The column names and types and the chunk size are either read
+// from the meta file next to it or taken from a table definition, i.e., a table whose columns were defined with
+// add_column_definition().
+// The file is mapped into memory and split into byte ranges of chunk_size rows each (or of a fixed number of rows
+// for tables with unlimited chunks). The ranges are parsed in parallel jobs, each of which writes the values directly
+// into typed vectors that become the ValueColumns of one chunk. Finding the range boundaries needs one sequential
+// pass over the file, as a line break only ends a row outside of quotes, but that pass only looks for quotes and line
+// breaks, a SIMD block at a time.
+// If a table name is given, the table is added to the StorageManager under that name, or, if the StorageManager
+// already has a table of that name, that table is the output and the file is not read.
+class ImportCsv : public AbstractOperator {
+ public:
+  explicit ImportCsv(const std::string& filename, const std::optional<std::string> tablename = std::nullopt);
+  ImportCsv(const std::string& filename, const std::shared_ptr<const Table> table_definition,
+            const std::optional<std::string> tablename = std::nullopt);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _filename;
+  const std::shared_ptr<const Table> _table_definition;
+  const std::optional<std::string> _tablename;
+};
+
+}  // namespace opossum
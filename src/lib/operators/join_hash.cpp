@@ -0,0 +1,305 @@
+#include "join_hash.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/for_each_value.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/mixed_hash.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Partitions should be small enough for their hash table to stay in the cache. More than 2^10 partitions make the
+// partitioning itself expensive, as each partition is written to a different place in memory.
+constexpr auto ROWS_PER_PARTITION = size_t{8192};
+constexpr auto MAX_RADIX_BITS = size_t{10};
+
+// the hash bits are mixed to also spread keys with regular patterns, e.g., multiples of 1024, over all partitions
+template <typename T>
+size_t partition_hash(const T& value) {
+  return static_cast<size_t>(mixed_hash(value));
+}
+
+template <typename T>
+struct JoinElement {
+  T value;
+  RowID row_id;
+};
+
+// all elements of one input, ordered by partition. Partition i consists of the elements [offsets[i], offsets[i + 1]).
+// Rows with a NULL key never match and are kept apart in null_row_ids.
+template <typename T>
+struct RadixPartitions {
+  std::vector<JoinElement<T>> elements;
+  std::vector<size_t> offsets;
+  PosList null_row_ids;
+};
+
+// Materializes the join column of a table as JoinElements and sorts them into partitions. Chunks are processed in
+// parallel: each chunk first counts its elements per partition, which tells every chunk where to write its elements
+// in each partition, so that they can then be scattered without synchronization.
+template <typename T, typename ColumnType>
+RadixPartitions<T> partition_input(const Table& table, const ColumnID column_id, const size_t radix_bits) {
+  const auto partition_count = size_t{1} << radix_bits;
+  const auto partition_mask = partition_count - 1;
+  const auto chunk_count = table.chunk_count();
+
+  std::vector<std::vector<JoinElement<T>>> chunk_elements(chunk_count);
+  std::vector<std::vector<size_t>> histograms(chunk_count, std::vector<size_t>(partition_count));
+  std::vector<PosList> chunk_null_row_ids(chunk_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& elements = chunk_elements[chunk_id];
+      auto& histogram = histograms[chunk_id];
+      elements.reserve(chunk.size());
+
+      for_each_value_or_null<ColumnType>(
+          *chunk.get_column(column_id),
+          [&](const ColumnType& value, const ChunkOffset offset) {
+            const auto key = static_cast<T>(value);
+            ++histogram[partition_hash(key) & partition_mask];
+            elements.push_back(JoinElement<T>{key, RowID{chunk_id, offset}});
+          },
+          [&](const ChunkOffset offset) { chunk_null_row_ids[chunk_id].push_back(RowID{chunk_id, offset}); });
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // the elements of a chunk start in each partition where those of the previous chunk end
+  RadixPartitions<T> partitions;
+  partitions.offsets.resize(partition_count + 1);
+  std::vector<std::vector<size_t>> write_positions(chunk_count, std::vector<size_t>(partition_count));
+  auto element_count = size_t{0};
+  for (size_t partition_id = 0; partition_id < partition_count; ++partition_id) {
+    partitions.offsets[partition_id] = element_count;
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      write_positions[chunk_id][partition_id] = element_count;
+      element_count += histograms[chunk_id][partition_id];
+    }
+  }
+  partitions.offsets[partition_count] = element_count;
+  partitions.elements.resize(element_count);
+
+  jobs.clear();
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (chunk_elements[chunk_id].empty()) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& positions = write_positions[chunk_id];
+      for (auto& element : chunk_elements[chunk_id]) {
+        const auto partition_id = partition_hash(element.value) & partition_mask;
+        partitions.elements[positions[partition_id]++] = std::move(element);
+      }
+      chunk_elements[chunk_id] = {};
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (const auto& null_row_ids : chunk_null_row_ids) {
+    partitions.null_row_ids.insert(partitions.null_row_ids.end(), null_row_ids.cbegin(), null_row_ids.cend());
+  }
+
+  return partitions;
+}
+
+// JoinHashImpl joins the inputs after casting the join keys of the left (LeftType) and right (RightType) column to
+// their common type T
+template <typename T, typename LeftType, typename RightType>
+class JoinHashImpl {
+ public:
+  JoinHashImpl(const Table& left, const Table& right, const JoinMode mode,
+               const std::pair<ColumnID, ColumnID>& column_ids)
+      : _left(left), _right(right), _mode(mode), _column_ids(column_ids) {}
+
+  // fills the positions of the joined rows in the left and the right input. For Semi and Anti joins, the positions
+  // of the right input stay empty.
+  void execute(PosList& left_pos_list, PosList& right_pos_list) const {
+    // The hash table is built on the right input and probed with the left one. This is turned around for Right joins
+    // and for Inner joins with a smaller left input, which are cheaper to build on.
+    const auto build_left = this->_mode == JoinMode::Right ||
+                            (this->_mode == JoinMode::Inner && this->_left.row_count() < this->_right.row_count());
+    const auto& build_table = build_left ? this->_left : this->_right;
+
+    auto radix_bits = size_t{0};
+    while (radix_bits < MAX_RADIX_BITS && (ROWS_PER_PARTITION << radix_bits) < build_table.row_count()) {
+      ++radix_bits;
+    }
+
+    const auto left_partitions = partition_input<T, LeftType>(this->_left, this->_column_ids.first, radix_bits);
+    const auto right_partitions = partition_input<T, RightType>(this->_right, this->_column_ids.second, radix_bits);
+    const auto& build_partitions = build_left ? left_partitions : right_partitions;
+    const auto& probe_partitions = build_left ? right_partitions : left_partitions;
+
+    const auto partition_count = size_t{1} << radix_bits;
+    std::vector<PosList> build_pos_lists(partition_count);
+    std::vector<PosList> probe_pos_lists(partition_count);
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    for (size_t partition_id = 0; partition_id < partition_count; ++partition_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+        this->_join_partition(build_partitions, probe_partitions, partition_id, build_pos_lists[partition_id],
+                              probe_pos_lists[partition_id]);
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+    _concatenate(build_left ? build_pos_lists : probe_pos_lists, left_pos_list);
+    if (this->_mode != JoinMode::Semi && this->_mode != JoinMode::Anti) {
+      _concatenate(build_left ? probe_pos_lists : build_pos_lists, right_pos_list);
+    }
+
+    // rows with a NULL key match nothing, so they only appear in the output of the side(s) that are preserved
+    if (this->_mode == JoinMode::Anti) {
+      const auto& null_row_ids = left_partitions.null_row_ids;
+      left_pos_list.insert(left_pos_list.end(), null_row_ids.cbegin(), null_row_ids.cend());
+    }
+    if (this->_mode == JoinMode::Left || this->_mode == JoinMode::Outer) {
+      for (const auto& row_id : left_partitions.null_row_ids) {
+        left_pos_list.push_back(row_id);
+        right_pos_list.push_back(NULL_ROW_ID);
+      }
+    }
+    if (this->_mode == JoinMode::Right || this->_mode == JoinMode::Outer) {
+      for (const auto& row_id : right_partitions.null_row_ids) {
+        left_pos_list.push_back(NULL_ROW_ID);
+        right_pos_list.push_back(row_id);
+      }
+    }
+  }
+
+ protected:
+  void _join_partition(const RadixPartitions<T>& build_partitions, const RadixPartitions<T>& probe_partitions,
+                       const size_t partition_id, PosList& build_pos_list, PosList& probe_pos_list) const {
+    const auto build_begin = build_partitions.offsets[partition_id];
+    const auto build_end = build_partitions.offsets[partition_id + 1];
+    const auto probe_begin = probe_partitions.offsets[partition_id];
+    const auto probe_end = probe_partitions.offsets[partition_id + 1];
+
+    const auto emit_unmatched_probe_rows =
+        this->_mode == JoinMode::Left || this->_mode == JoinMode::Right || this->_mode == JoinMode::Outer;
+    const auto emit_unmatched_build_rows = this->_mode == JoinMode::Outer;
+
+    // maps each key to the positions of its elements within the build partition
+    std::unordered_map<T, std::vector<size_t>> hash_table;
+    hash_table.reserve(build_end - build_begin);
+    for (auto index = build_begin; index < build_end; ++index) {
+      hash_table[build_partitions.elements[index].value].push_back(index);
+    }
+
+    std::vector<bool> build_matched(emit_unmatched_build_rows ? build_end - build_begin : 0, false);
+
+    for (auto index = probe_begin; index < probe_end; ++index) {
+      const auto& probe_element = probe_partitions.elements[index];
+      const auto it = hash_table.find(probe_element.value);
+
+      if (it == hash_table.end()) {
+        if (this->_mode == JoinMode::Anti) {
+          probe_pos_list.push_back(probe_element.row_id);
+        } else if (emit_unmatched_probe_rows) {
+          probe_pos_list.push_back(probe_element.row_id);
+          build_pos_list.push_back(NULL_ROW_ID);
+        }
+        continue;
+      }
+
+      if (this->_mode == JoinMode::Semi) {
+        probe_pos_list.push_back(probe_element.row_id);
+        continue;
+      }
+      if (this->_mode == JoinMode::Anti) continue;
+
+      for (const auto build_index : it->second) {
+        probe_pos_list.push_back(probe_element.row_id);
+        build_pos_list.push_back(build_partitions.elements[build_index].row_id);
+        if (emit_unmatched_build_rows) build_matched[build_index - build_begin] = true;
+      }
+    }
+
+    if (emit_unmatched_build_rows) {
+      for (auto index = build_begin; index < build_end; ++index) {
+        if (build_matched[index - build_begin]) continue;
+        probe_pos_list.push_back(NULL_ROW_ID);
+        build_pos_list.push_back(build_partitions.elements[index].row_id);
+      }
+    }
+  }
+
+  static void _concatenate(const std::vector<PosList>& pos_lists, PosList& output) {
+    auto size = size_t{0};
+    for (const auto& pos_list : pos_lists) size += pos_list.size();
+    output.reserve(size);
+    for (const auto& pos_list : pos_lists) output.insert(output.end(), pos_list.cbegin(), pos_list.cend());
+  }
+
+  const Table& _left;
+  const Table& _right;
+  const JoinMode _mode;
+  const std::pair<ColumnID, ColumnID> _column_ids;
+};
+
+}  // namespace
+
+JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator> left,
+                   const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
+                   const std::pair<ColumnID, ColumnID>& column_ids)
+    : AbstractOperator(left, right), _mode(mode), _column_ids(column_ids) {}
+
+JoinMode JoinHash::mode() const { return this->_mode; }
+
+const std::pair<ColumnID, ColumnID>& JoinHash::column_ids() const { return this->_column_ids; }
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  const auto left_table = this->_input_table_left();
+  const auto right_table = this->_input_table_right();
+
+  auto left_pos_list = std::make_shared<PosList>();
+  auto right_pos_list = std::make_shared<PosList>();
+
+  const auto& left_type = left_table->column_type(this->_column_ids.first);
+  const auto& right_type = right_table->column_type(this->_column_ids.second);
+  resolve_comparable_data_types(left_type, right_type, [&](auto left, auto right, auto common) {
+    using LeftType = typename decltype(left)::type;
+    using RightType = typename decltype(right)::type;
+    using CommonType = typename decltype(common)::type;
+
+    JoinHashImpl<CommonType, LeftType, RightType>(*left_table, *right_table, this->_mode, this->_column_ids)
+        .execute(*left_pos_list, *right_pos_list);
+  });
+
+  const auto output_right_columns = this->_mode != JoinMode::Semi && this->_mode != JoinMode::Anti;
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < left_table->column_names().size(); ++column_id) {
+    output_table->add_column_definition(left_table->column_name(column_id), left_table->column_type(column_id));
+  }
+  if (output_right_columns) {
+    for (ColumnID column_id{0}; column_id < right_table->column_names().size(); ++column_id) {
+      output_table->add_column_definition(right_table->column_name(column_id), right_table->column_type(column_id));
+    }
+  }
+
+  Chunk output_chunk;
+  this->_add_reference_columns(output_chunk, left_table, left_pos_list);
+  if (output_right_columns) this->_add_reference_columns(output_chunk, right_table, right_pos_list);
+  output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+}  // namespace opossum
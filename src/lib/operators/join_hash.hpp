@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// JoinHash joins two tables on the equality of one column each. It is a radix hash join: both inputs are split into
+// partitions by the hash of their join keys, so that the hash table of each partition fits into the cache, and the
+// partitions are then built and probed in parallel.
+// Columns of the same type can always be joined. Integer columns (int, long) and floating point columns (float,
+// double) can also be joined with each other, in which case the keys are compared as long or double, respectively.
+// The output contains the columns of the left input followed by those of the right input (Semi and Anti joins only
+// output the left columns). It consists of ReferenceColumns, where NULL_ROW_ID stands for the missing partner of an
+// unmatched row in Left, Right, and Outer joins. The order of the output rows is not specified.
+class JoinHash : public AbstractOperator {
+ public:
+  JoinHash(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+           const JoinMode mode, const std::pair<ColumnID, ColumnID>& column_ids);
+
+  JoinMode mode() const;
+  const std::pair<ColumnID, ColumnID>& column_ids() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const JoinMode _mode;
+  const std::pair<ColumnID, ColumnID> _column_ids;
+};
+
+}  // namespace opossum
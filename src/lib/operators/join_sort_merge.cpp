@@ -0,0 +1,211 @@
+#include "join_sort_merge.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "multiway_merge.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/for_each_value.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the sorted left input is joined in parts of this size, each by its own job
+constexpr auto ROWS_PER_JOIN_PART = size_t{1} << 14;
+
+template <typename T>
+struct SortedElement {
+  T value;
+  RowID row_id;
+};
+
+// JoinSortMergeImpl joins the inputs after casting the join keys of the left (LeftType) and right (RightType) column
+// to their common type T
+template <typename T, typename LeftType, typename RightType>
+class JoinSortMergeImpl {
+ public:
+  JoinSortMergeImpl(const Table& left, const Table& right, const ScanType scan_type,
+                    const std::pair<ColumnID, ColumnID>& column_ids)
+      : _left(left), _right(right), _scan_type(scan_type), _column_ids(column_ids) {}
+
+  void execute(PosList& left_pos_list, PosList& right_pos_list) const {
+    const auto left_elements = _sort_input<LeftType>(this->_left, this->_column_ids.first);
+    const auto right_elements = _sort_input<RightType>(this->_right, this->_column_ids.second);
+
+    const auto part_count = std::max(size_t{1}, left_elements.size() / ROWS_PER_JOIN_PART);
+    std::vector<PosList> left_pos_lists(part_count);
+    std::vector<PosList> right_pos_lists(part_count);
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    for (size_t part_id = 0; part_id < part_count; ++part_id) {
+      const auto begin = part_id * left_elements.size() / part_count;
+      const auto end = (part_id + 1) * left_elements.size() / part_count;
+      if (begin == end) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, part_id, begin, end]() {
+        this->_join_part(left_elements, right_elements, begin, end, left_pos_lists[part_id],
+                         right_pos_lists[part_id]);
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+    _concatenate(left_pos_lists, left_pos_list);
+    _concatenate(right_pos_lists, right_pos_list);
+  }
+
+ protected:
+  // materializes the join column and sorts it by value: each chunk is sorted by its own job, and the sorted chunks
+  // are merged afterwards
+  template <typename ColumnType>
+  static std::vector<SortedElement<T>> _sort_input(const Table& table, const ColumnID column_id) {
+    const auto compare = [](const SortedElement<T>& left, const SortedElement<T>& right) {
+      return left.value < right.value;
+    };
+
+    std::vector<std::vector<SortedElement<T>>> runs(table.chunk_count());
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      if (chunk.size() == 0) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        auto& run = runs[chunk_id];
+        run.reserve(chunk.size());
+        const auto& column = *chunk.get_column(column_id);
+        for_each_value<ColumnType>(column, [&](const ColumnType& value, const ChunkOffset offset) {
+          run.push_back(SortedElement<T>{static_cast<T>(value), RowID{chunk_id, offset}});
+        });
+        std::sort(run.begin(), run.end(), compare);
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+    return multiway_merge(runs, compare);
+  }
+
+  // Joins the left elements [begin, end) with all matching right elements. For each left value, lower is the number
+  // of right values that are smaller, and upper the number of right values that are smaller or equal. Both only grow
+  // with the left value, and the matches are the right elements
+  //   [lower, upper) for OpEquals,   [upper, size) for OpLessThan,   [lower, size) for OpLessThanEquals,
+  //   [0, lower) for OpGreaterThan,  [0, upper) for OpGreaterThanEquals
+  void _join_part(const std::vector<SortedElement<T>>& left_elements,
+                  const std::vector<SortedElement<T>>& right_elements, const size_t begin, const size_t end,
+                  PosList& left_pos_list, PosList& right_pos_list) const {
+    const auto compare_value = [](const SortedElement<T>& element, const T& value) { return element.value < value; };
+    const auto compare_element = [](const T& value, const SortedElement<T>& element) { return value < element.value; };
+
+    // the bounds of the first left value are searched, all others are found by moving on from there
+    const auto& first_value = left_elements[begin].value;
+    auto lower = static_cast<size_t>(std::distance(
+        right_elements.cbegin(),
+        std::lower_bound(right_elements.cbegin(), right_elements.cend(), first_value, compare_value)));
+    auto upper = static_cast<size_t>(std::distance(
+        right_elements.cbegin(),
+        std::upper_bound(right_elements.cbegin(), right_elements.cend(), first_value, compare_element)));
+
+    for (auto left_index = begin; left_index < end; ++left_index) {
+      const auto& left_element = left_elements[left_index];
+      while (lower < right_elements.size() && right_elements[lower].value < left_element.value) ++lower;
+      upper = std::max(upper, lower);
+      while (upper < right_elements.size() && !(left_element.value < right_elements[upper].value)) ++upper;
+
+      auto match_begin = size_t{0};
+      auto match_end = right_elements.size();
+      switch (this->_scan_type) {
+        case ScanType::OpEquals:
+          match_begin = lower;
+          match_end = upper;
+          break;
+        case ScanType::OpLessThan:
+          match_begin = upper;
+          break;
+        case ScanType::OpLessThanEquals:
+          match_begin = lower;
+          break;
+        case ScanType::OpGreaterThan:
+          match_end = lower;
+          break;
+        case ScanType::OpGreaterThanEquals:
+          match_end = upper;
+          break;
+        default:
+          Fail("Unsupported scan type");
+      }
+
+      for (auto right_index = match_begin; right_index < match_end; ++right_index) {
+        left_pos_list.push_back(left_element.row_id);
+        right_pos_list.push_back(right_elements[right_index].row_id);
+      }
+    }
+  }
+
+  static void _concatenate(const std::vector<PosList>& pos_lists, PosList& output) {
+    auto size = size_t{0};
+    for (const auto& pos_list : pos_lists) size += pos_list.size();
+    output.reserve(size);
+    for (const auto& pos_list : pos_lists) output.insert(output.end(), pos_list.cbegin(), pos_list.cend());
+  }
+
+  const Table& _left;
+  const Table& _right;
+  const ScanType _scan_type;
+  const std::pair<ColumnID, ColumnID> _column_ids;
+};
+
+}  // namespace
+
+JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator> left,
+                             const std::shared_ptr<const AbstractOperator> right, const ScanType scan_type,
+                             const std::pair<ColumnID, ColumnID>& column_ids)
+    : AbstractOperator(left, right), _scan_type(scan_type), _column_ids(column_ids) {
+  Assert(scan_type != ScanType::OpNotEquals && scan_type != ScanType::OpBetween,
+         "JoinSortMerge does not support OpNotEquals and OpBetween");
+}
+
+ScanType JoinSortMerge::scan_type() const { return this->_scan_type; }
+
+const std::pair<ColumnID, ColumnID>& JoinSortMerge::column_ids() const { return this->_column_ids; }
+
+std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
+  const auto left_table = this->_input_table_left();
+  const auto right_table = this->_input_table_right();
+
+  auto left_pos_list = std::make_shared<PosList>();
+  auto right_pos_list = std::make_shared<PosList>();
+
+  const auto& left_type = left_table->column_type(this->_column_ids.first);
+  const auto& right_type = right_table->column_type(this->_column_ids.second);
+  resolve_comparable_data_types(left_type, right_type, [&](auto left, auto right, auto common) {
+    using LeftType = typename decltype(left)::type;
+    using RightType = typename decltype(right)::type;
+    using CommonType = typename decltype(common)::type;
+
+    JoinSortMergeImpl<CommonType, LeftType, RightType>(*left_table, *right_table, this->_scan_type, this->_column_ids)
+        .execute(*left_pos_list, *right_pos_list);
+  });
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < left_table->column_names().size(); ++column_id) {
+    output_table->add_column_definition(left_table->column_name(column_id), left_table->column_type(column_id));
+  }
+  for (ColumnID column_id{0}; column_id < right_table->column_names().size(); ++column_id) {
+    output_table->add_column_definition(right_table->column_name(column_id), right_table->column_type(column_id));
+  }
+
+  Chunk output_chunk;
+  this->_add_reference_columns(output_chunk, left_table, left_pos_list);
+  this->_add_reference_columns(output_chunk, right_table, right_pos_list);
+  output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// JoinSortMerge is an inner join of two tables on a comparison of one column each, i.e., left_value <scan_type>
+// right_value. Unlike JoinHash, it also supports the non-equi comparisons OpLessThan, OpLessThanEquals,
+// OpGreaterThan, and OpGreaterThanEquals (OpNotEquals and OpBetween are not supported).
+// Both inputs are sorted chunk by chunk in parallel and then combined by a parallel multiway merge. Afterwards, the
+// matches of each left value form a single range of the sorted right input, and the ranges of consecutive left
+// values move in one direction only, so that they can be found without searching.
+// The column types are handled like in JoinHash. The output contains the columns of the left input followed by those
+// of the right input as ReferenceColumns, ordered by the left join column.
+class JoinSortMerge : public AbstractOperator {
+ public:
+  JoinSortMerge(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+                const ScanType scan_type, const std::pair<ColumnID, ColumnID>& column_ids);
+
+  ScanType scan_type() const;
+  const std::pair<ColumnID, ColumnID>& column_ids() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ScanType _scan_type;
+  const std::pair<ColumnID, ColumnID> _column_ids;
+};
+
+}  // namespace opossum
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+
+namespace opossum {
+
+namespace detail {
+
+// parts are not worth their scheduling overhead below this size
+constexpr auto MIN_ELEMENTS_PER_MERGE_PART = size_t{1} << 16;
+constexpr auto MAX_MERGE_PARTS = size_t{64};
+
+}  // namespace detail
+
+/**
+ * Merges runs that are sorted by compare into a single sorted vector. The runs are consumed, i.e., their elements
+ * are moved into the result.
+ *
+ * The merge runs in parallel: splitter values sampled from all runs divide each run into the same number of parts,
+ * so that the n-th part of every run only holds elements that belong between the splitters n - 1 and n. Every part
+ * is then merged by its own job, which repeatedly takes the smallest head of its runs from a heap.
+ *
+ * Example:
+ *
+ *   std::vector<std::vector<int>> runs(chunk_count);
+ *   ... sort each run in parallel ...
+ *   const auto sorted = multiway_merge(runs, std::less<int>{});
+ */
+template <typename T, typename Compare>
+std::vector<T> multiway_merge(std::vector<std::vector<T>>& runs, const Compare& compare) {
+  auto element_count = size_t{0};
+  for (const auto& run : runs) element_count += run.size();
+
+  const auto part_count =
+      std::clamp(element_count / detail::MIN_ELEMENTS_PER_MERGE_PART, size_t{1}, detail::MAX_MERGE_PARTS);
+
+  // take part_count evenly spaced samples from each run and choose part_count - 1 evenly spaced splitters among them
+  std::vector<T> samples;
+  for (const auto& run : runs) {
+    for (size_t sample_id = 0; sample_id < part_count && !run.empty(); ++sample_id) {
+      samples.push_back(run[sample_id * run.size() / part_count]);
+    }
+  }
+  std::sort(samples.begin(), samples.end(), compare);
+
+  std::vector<T> splitters;
+  for (size_t part_id = 1; part_id < part_count; ++part_id) {
+    splitters.push_back(samples[part_id * samples.size() / part_count]);
+  }
+
+  // part_bounds[run_id][part_id] is where the part starts in the run. The part of all runs starts at part_offsets.
+  std::vector<std::vector<size_t>> part_bounds(runs.size(), std::vector<size_t>(part_count + 1));
+  std::vector<size_t> part_offsets(part_count + 1);
+  for (size_t run_id = 0; run_id < runs.size(); ++run_id) {
+    const auto& run = runs[run_id];
+    part_bounds[run_id][part_count] = run.size();
+    for (size_t part_id = 1; part_id < part_count; ++part_id) {
+      const auto bound = std::lower_bound(run.cbegin(), run.cend(), splitters[part_id - 1], compare);
+      part_bounds[run_id][part_id] = static_cast<size_t>(std::distance(run.cbegin(), bound));
+    }
+    for (size_t part_id = 0; part_id < part_count; ++part_id) {
+      part_offsets[part_id + 1] += part_bounds[run_id][part_id + 1] - part_bounds[run_id][part_id];
+    }
+  }
+  for (size_t part_id = 0; part_id < part_count; ++part_id) part_offsets[part_id + 1] += part_offsets[part_id];
+
+  std::vector<T> output(element_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (size_t part_id = 0; part_id < part_count; ++part_id) {
+    if (part_offsets[part_id] == part_offsets[part_id + 1]) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, part_id]() {
+      // the positions of the next and the end of each run within this part
+      std::vector<std::pair<size_t, size_t>> cursors(runs.size());
+      std::vector<size_t> heap;
+      for (size_t run_id = 0; run_id < runs.size(); ++run_id) {
+        cursors[run_id] = {part_bounds[run_id][part_id], part_bounds[run_id][part_id + 1]};
+        if (cursors[run_id].first < cursors[run_id].second) heap.push_back(run_id);
+      }
+
+      // std::*_heap keeps the largest element on top, so the comparison is reversed to get the smallest head
+      const auto heap_compare = [&](const size_t left_run_id, const size_t right_run_id) {
+        return compare(runs[right_run_id][cursors[right_run_id].first], runs[left_run_id][cursors[left_run_id].first]);
+      };
+      std::make_heap(heap.begin(), heap.end(), heap_compare);
+
+      auto output_position = part_offsets[part_id];
+      while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), heap_compare);
+        const auto run_id = heap.back();
+        auto& cursor = cursors[run_id];
+
+        output[output_position++] = std::move(runs[run_id][cursor.first++]);
+
+        if (cursor.first < cursor.second) {
+          std::push_heap(heap.begin(), heap.end(), heap_compare);
+        } else {
+          heap.pop_back();
+        }
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  runs.clear();
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,310 @@
+#include "projection.hpp"
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/for_each_value.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// returns the type string of a column type, e.g., "long" for int64_t
+template <typename T>
+std::string data_type_name() {
+  std::string name;
+  hana::for_each(column_types, [&](auto x) {
+    if (hana::second(x) == hana::type_c<T>) name = hana::first(x);
+  });
+  return name;
+}
+
+// returns the type string of the type that arithmetic operations on the given types result in
+template <typename LeftType, typename RightType>
+std::string common_data_type_name(hana::basic_type<LeftType>, hana::basic_type<RightType>) {
+  if constexpr (std::is_arithmetic_v<LeftType> && std::is_arithmetic_v<RightType>) {
+    return data_type_name<std::common_type_t<LeftType, RightType>>();
+  } else {
+    Fail("Arithmetic operations are not supported for strings");
+  }
+}
+
+// a literal operand, which can be indexed like the values of a column
+template <typename T>
+struct Scalar {
+  const T& operator[](const size_t) const { return value; }
+
+  T value;
+};
+
+template <typename T>
+pmr_vector<T> evaluate(const ProjectionExpression& expression, const Table& table, const Chunk& chunk);
+
+// Calls func with the values of the expression in the given chunk, which are a Scalar<T> for literals, a pointer to
+// the values of a ValueColumn, which are passed on without copying them, or a pmr_vector<T>.
+template <typename T, typename Functor>
+void with_operand(const ProjectionExpression& expression, const Table& table, const Chunk& chunk, const Functor& func) {
+  if (expression.type() == ProjectionExpression::Type::Literal) {
+    func(Scalar<T>{type_cast<T>(expression.value())});
+    return;
+  }
+
+  if (expression.type() == ProjectionExpression::Type::Column) {
+    const auto column = chunk.get_column(expression.column_id());
+    if (const auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column)) {
+      func(value_column->data());
+      return;
+    }
+  }
+
+  func(evaluate<T>(expression, table, chunk));
+}
+
+// the loop that all arithmetic operations are compiled to, without any branches or virtual calls
+template <typename T, typename Left, typename Right, typename Operator>
+void apply_elementwise(const Left& left, const Right& right, pmr_vector<T>& result, const Operator& op) {
+  const auto size = result.size();
+  for (size_t index = 0; index < size; ++index) {
+    result[index] = op(static_cast<T>(left[index]), static_cast<T>(right[index]));
+  }
+}
+
+// Signed integer overflow is undefined, so integers are added, subtracted, and multiplied as their unsigned
+// counterparts, which wrap around. Converting the result back to the signed type is modular with all supported
+// compilers (and guaranteed since C++20).
+template <typename T, template <typename> class Operator>
+struct WrappingOperator {
+  T operator()(const T left, const T right) const {
+    if constexpr (std::is_integral_v<T>) {
+      using Unsigned = std::make_unsigned_t<T>;
+      return static_cast<T>(Operator<Unsigned>{}(static_cast<Unsigned>(left), static_cast<Unsigned>(right)));
+    } else {
+      return Operator<T>{}(left, right);
+    }
+  }
+};
+
+template <typename T, typename Left, typename Right>
+void apply_arithmetic(const ArithmeticOperator arithmetic_operator, const Left& left, const Right& right,
+                      pmr_vector<T>& result) {
+  switch (arithmetic_operator) {
+    case ArithmeticOperator::Addition:
+      return apply_elementwise(left, right, result, WrappingOperator<T, std::plus>{});
+    case ArithmeticOperator::Subtraction:
+      return apply_elementwise(left, right, result, WrappingOperator<T, std::minus>{});
+    case ArithmeticOperator::Multiplication:
+      return apply_elementwise(left, right, result, WrappingOperator<T, std::multiplies>{});
+    case ArithmeticOperator::Division:
+      // both raise SIGFPE instead of wrapping around
+      if constexpr (std::is_integral_v<T>) {
+        for (size_t index = 0; index < result.size(); ++index) {
+          const auto divisor = static_cast<T>(right[index]);
+          if (divisor == 0) Fail("Integer division by zero");
+          if constexpr (std::is_signed_v<T>) {
+            if (divisor == -1 && static_cast<T>(left[index]) == std::numeric_limits<T>::min()) {
+              Fail("Integer division overflows");
+            }
+          }
+        }
+      }
+      return apply_elementwise(left, right, result, std::divides<T>{});
+  }
+}
+
+// evaluates an arithmetic expression whose operands have the given types
+template <typename T, typename LeftType, typename RightType>
+void evaluate_arithmetic(const ProjectionExpression& expression, const Table& table, const Chunk& chunk,
+                         pmr_vector<T>& result, hana::basic_type<LeftType>, hana::basic_type<RightType>) {
+  // only the combinations that result in T are instantiated
+  if constexpr (std::is_arithmetic_v<LeftType> && std::is_arithmetic_v<RightType>) {
+    if constexpr (std::is_same_v<std::common_type_t<LeftType, RightType>, T>) {
+      with_operand<LeftType>(*expression.left(), table, chunk, [&](const auto& left_operand) {
+        with_operand<RightType>(*expression.right(), table, chunk, [&](const auto& right_operand) {
+          apply_arithmetic(expression.arithmetic_operator(), left_operand, right_operand, result);
+        });
+      });
+    }
+  }
+}
+
+// evaluates a cast whose operand has the given type
+template <typename T, typename OperandType>
+void evaluate_cast(const ProjectionExpression& expression, const Table& table, const Chunk& chunk,
+                   pmr_vector<T>& result, hana::basic_type<OperandType>) {
+  if constexpr (std::is_arithmetic_v<T> && std::is_arithmetic_v<OperandType>) {
+    with_operand<OperandType>(*expression.left(), table, chunk, [&](const auto& operand) {
+      for (size_t index = 0; index < result.size(); ++index) result[index] = static_cast<T>(operand[index]);
+    });
+  }
+}
+
+template <typename T>
+pmr_vector<T> evaluate(const ProjectionExpression& expression, const Table& table, const Chunk& chunk) {
+  switch (expression.type()) {
+    case ProjectionExpression::Type::Column: {
+      pmr_vector<T> values;
+      values.reserve(chunk.size());
+      for_each_value_or_null<T>(*chunk.get_column(expression.column_id()),
+                                [&](const T& value, const ChunkOffset) { values.push_back(value); },
+                                [](const ChunkOffset) { Fail("Projection does not support NULL values"); });
+      return values;
+    }
+
+    case ProjectionExpression::Type::Literal:
+      return pmr_vector<T>(chunk.size(), type_cast<T>(expression.value()));
+
+    case ProjectionExpression::Type::Arithmetic: {
+      pmr_vector<T> result(chunk.size());
+      resolve_data_type(expression.left()->data_type(table), [&](auto left_type) {
+        resolve_data_type(expression.right()->data_type(table), [&](auto right_type) {
+          evaluate_arithmetic(expression, table, chunk, result, left_type, right_type);
+        });
+      });
+      return result;
+    }
+
+    case ProjectionExpression::Type::Cast: {
+      pmr_vector<T> result(chunk.size());
+      resolve_data_type(expression.left()->data_type(table), [&](auto operand_type) {
+        evaluate_cast(expression, table, chunk, result, operand_type);
+      });
+      return result;
+    }
+  }
+  Fail("Unknown expression type");
+}
+
+}  // namespace
+
+ProjectionExpression::ProjectionExpression(const Type type) : _type(type) {}
+
+std::shared_ptr<ProjectionExpression> ProjectionExpression::column(const ColumnID column_id) {
+  auto expression = std::shared_ptr<ProjectionExpression>(new ProjectionExpression(Type::Column));
+  expression->_column_id = column_id;
+  return expression;
+}
+
+std::shared_ptr<ProjectionExpression> ProjectionExpression::literal(const AllTypeVariant& value) {
+  auto expression = std::shared_ptr<ProjectionExpression>(new ProjectionExpression(Type::Literal));
+  expression->_value = value;
+  return expression;
+}
+
+std::shared_ptr<ProjectionExpression> ProjectionExpression::arithmetic(
+    const ArithmeticOperator arithmetic_operator, const std::shared_ptr<ProjectionExpression>& left,
+    const std::shared_ptr<ProjectionExpression>& right) {
+  Assert(left && right, "Arithmetic operations need two operands");
+  auto expression = std::shared_ptr<ProjectionExpression>(new ProjectionExpression(Type::Arithmetic));
+  expression->_arithmetic_operator = arithmetic_operator;
+  expression->_left = left;
+  expression->_right = right;
+  return expression;
+}
+
+std::shared_ptr<ProjectionExpression> ProjectionExpression::cast(const std::shared_ptr<ProjectionExpression>& operand,
+                                                                 const std::string& data_type) {
+  Assert(static_cast<bool>(operand), "Casts need an operand");
+  Assert(data_type != "string", "Casts to string are not supported");
+  auto expression = std::shared_ptr<ProjectionExpression>(new ProjectionExpression(Type::Cast));
+  expression->_left = operand;
+  expression->_cast_data_type = data_type;
+  return expression;
+}
+
+ProjectionExpression::Type ProjectionExpression::type() const { return this->_type; }
+
+ColumnID ProjectionExpression::column_id() const { return this->_column_id; }
+
+const AllTypeVariant& ProjectionExpression::value() const { return this->_value; }
+
+ArithmeticOperator ProjectionExpression::arithmetic_operator() const { return this->_arithmetic_operator; }
+
+const std::shared_ptr<ProjectionExpression>& ProjectionExpression::left() const { return this->_left; }
+
+const std::shared_ptr<ProjectionExpression>& ProjectionExpression::right() const { return this->_right; }
+
+std::string ProjectionExpression::data_type(const Table& table) const {
+  switch (this->_type) {
+    case Type::Column:
+      return table.column_type(this->_column_id);
+
+    case Type::Literal: {
+      std::string data_type;
+      const auto type_index = static_cast<size_t>(this->_value.which());
+      hana::for_each(column_types, [&](auto x) {
+        if (type_index == detail::index_of(types, hana::second(x))) data_type = hana::first(x);
+      });
+      return data_type;
+    }
+
+    case Type::Arithmetic: {
+      std::string data_type;
+      resolve_data_type(this->_left->data_type(table), [&](auto left_type) {
+        resolve_data_type(this->_right->data_type(table), [&](auto right_type) {
+          data_type = common_data_type_name(left_type, right_type);
+        });
+      });
+      return data_type;
+    }
+
+    case Type::Cast:
+      Assert(this->_left->data_type(table) != "string", "Casts from string are not supported");
+      return this->_cast_data_type;
+  }
+  Fail("Unknown expression type");
+}
+
+Projection::Projection(const std::shared_ptr<const AbstractOperator> in,
+                       const std::vector<ProjectionDefinition>& definitions)
+    : AbstractOperator(in), _definitions(definitions) {
+  for (const auto& definition : definitions) {
+    Assert(static_cast<bool>(definition.expression), "Projection definitions need an expression");
+  }
+}
+
+const std::vector<ProjectionDefinition>& Projection::definitions() const { return this->_definitions; }
+
+std::shared_ptr<const Table> Projection::_on_execute() {
+  const auto input_table = this->_input_table_left();
+
+  auto output_table = std::make_shared<Table>();
+  std::vector<std::string> data_types;
+  for (const auto& definition : this->_definitions) {
+    data_types.push_back(definition.expression->data_type(*input_table));
+    output_table->add_column_definition(definition.name, data_types.back());
+  }
+
+  std::vector<Chunk> output_chunks(input_table->chunk_count());
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto& chunk = input_table->get_chunk(chunk_id);
+      for (size_t index = 0; index < this->_definitions.size(); ++index) {
+        resolve_data_type(data_types[index], [&](auto type) {
+          using Type = typename decltype(type)::type;
+          auto values = evaluate<Type>(*this->_definitions[index].expression, *input_table, chunk);
+          output_chunks[chunk_id].add_column(std::make_shared<ValueColumn<Type>>(std::move(values)));
+        });
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (auto& output_chunk : output_chunks) output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+}  // namespace opossum
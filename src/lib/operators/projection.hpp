@@ -0,0 +1,100 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class ArithmeticOperator {
+  Addition,
+  Subtraction,
+  Multiplication,
+  Division
+};
+
+// A node of an arithmetic expression tree, which is either a column of the input, a literal, an arithmetic operation
+// on two expressions, or a cast of an expression to another numeric type. Expressions are created by the static
+// factory methods, e.g., for (a + 1) * 0.5:
+//
+//   ProjectionExpression::arithmetic(ArithmeticOperator::Multiplication,
+//                                    ProjectionExpression::arithmetic(ArithmeticOperator::Addition,
+//                                                                     ProjectionExpression::column(ColumnID{0}),
+//                                                                     ProjectionExpression::literal(1)),
+//                                    ProjectionExpression::literal(0.5));
+class ProjectionExpression {
+ public:
+  enum class Type {
+    Column,
+    Literal,
+    Arithmetic,
+    Cast
+  };
+
+  static std::shared_ptr<ProjectionExpression> column(const ColumnID column_id);
+  static std::shared_ptr<ProjectionExpression> literal(const AllTypeVariant& value);
+  static std::shared_ptr<ProjectionExpression> arithmetic(const ArithmeticOperator arithmetic_operator,
+                                                          const std::shared_ptr<ProjectionExpression>& left,
+                                                          const std::shared_ptr<ProjectionExpression>& right);
+  static std::shared_ptr<ProjectionExpression> cast(const std::shared_ptr<ProjectionExpression>& operand,
+                                                    const std::string& data_type);
+
+  Type type() const;
+  ColumnID column_id() const;
+  const AllTypeVariant& value() const;
+  ArithmeticOperator arithmetic_operator() const;
+
+  // the operands of an arithmetic operation, or the operand of a cast as left()
+  const std::shared_ptr<ProjectionExpression>& left() const;
+  const std::shared_ptr<ProjectionExpression>& right() const;
+
+  // Returns the data type of the result, e.g., "long", when evaluated on the given table. Arithmetic operations are
+  // evaluated in the common type of their operands as in C++, e.g., int + long is a long and long * float a float.
+  // Only columns and literals may be strings.
+  std::string data_type(const Table& table) const;
+
+ protected:
+  explicit ProjectionExpression(const Type type);
+
+  const Type _type;
+  ColumnID _column_id{0};
+  AllTypeVariant _value;
+  ArithmeticOperator _arithmetic_operator = ArithmeticOperator::Addition;
+  std::shared_ptr<ProjectionExpression> _left;
+  std::shared_ptr<ProjectionExpression> _right;
+  // the target type of a cast
+  std::string _cast_data_type;
+};
+
+struct ProjectionDefinition {
+  std::shared_ptr<ProjectionExpression> expression;
+  std::string name;
+};
+
+// Projection computes one output column per definition by evaluating its expression on the input.
+// Expressions are evaluated column-at-a-time: the data types of an expression tree are resolved once per chunk,
+// and each operation runs as a tight loop over the typed values of its operands, which the compiler can vectorize.
+// ValueColumns of the input are read in place, other columns are materialized first.
+// Each chunk is evaluated by its own job. The output has one chunk of ValueColumns per input chunk.
+// Integer addition, subtraction, and multiplication wrap around on overflow. Integer division by zero fails, as does
+// dividing the smallest value of a type by -1. Values that a ReferenceColumn refers to with NULL_ROW_ID are not
+// supported.
+class Projection : public AbstractOperator {
+ public:
+  Projection(const std::shared_ptr<const AbstractOperator> in, const std::vector<ProjectionDefinition>& definitions);
+
+  const std::vector<ProjectionDefinition>& definitions() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<ProjectionDefinition> _definitions;
+};
+
+}  // namespace opossum
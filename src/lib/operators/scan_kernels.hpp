@@ -0,0 +1,382 @@
+#pragma once
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+/**
+ * Kernels that compare a contiguous array of values against one (or, for OpBetween, two) search values and append
+ * the positions of all matches to a PosList.
+ *
+ * For int32_t, int64_t, float, and double, the values are compared one SIMD register at a time. Which instruction
+ * set is used depends on the target of the build: AVX2 if available (e.g., in release builds with -march=native),
+ * otherwise SSE4.2. Without either, and for all other types, a scalar loop is used. The scalar loop writes every
+ * position and only advances the output if the value matched, so that it does not branch on the data.
+ *
+ * The scan type is resolved once per call by with_scan_predicate, so that the inner loops are specialized for
+ * a single comparison.
+ */
+
+namespace opossum {
+
+namespace detail {
+
+struct ScanEquals {
+  template <typename T>
+  static bool matches(const T& value, const T& search_value, const T&) {
+    return value == search_value;
+  }
+
+  template <typename Traits, typename Vector>
+  static uint32_t matches_mask(const Vector& values, const Vector& search_values, const Vector&) {
+    return Traits::equals(values, search_values);
+  }
+};
+
+struct ScanNotEquals {
+  template <typename T>
+  static bool matches(const T& value, const T& search_value, const T&) {
+    return value != search_value;
+  }
+
+  template <typename Traits, typename Vector>
+  static uint32_t matches_mask(const Vector& values, const Vector& search_values, const Vector&) {
+    return Traits::not_equals(values, search_values);
+  }
+};
+
+struct ScanLessThan {
+  template <typename T>
+  static bool matches(const T& value, const T& search_value, const T&) {
+    return value < search_value;
+  }
+
+  template <typename Traits, typename Vector>
+  static uint32_t matches_mask(const Vector& values, const Vector& search_values, const Vector&) {
+    return Traits::less_than(values, search_values);
+  }
+};
+
+struct ScanLessThanEquals {
+  template <typename T>
+  static bool matches(const T& value, const T& search_value, const T&) {
+    return value <= search_value;
+  }
+
+  template <typename Traits, typename Vector>
+  static uint32_t matches_mask(const Vector& values, const Vector& search_values, const Vector&) {
+    return Traits::less_than_equals(values, search_values);
+  }
+};
+
+struct ScanGreaterThan {
+  template <typename T>
+  static bool matches(const T& value, const T& search_value, const T&) {
+    return value > search_value;
+  }
+
+  template <typename Traits, typename Vector>
+  static uint32_t matches_mask(const Vector& values, const Vector& search_values, const Vector&) {
+    return Traits::greater_than(values, search_values);
+  }
+};
+
+struct ScanGreaterThanEquals {
+  template <typename T>
+  static bool matches(const T& value, const T& search_value, const T&) {
+    return value >= search_value;
+  }
+
+  template <typename Traits, typename Vector>
+  static uint32_t matches_mask(const Vector& values, const Vector& search_values, const Vector&) {
+    return Traits::greater_than_equals(values, search_values);
+  }
+};
+
+struct ScanBetween {
+  template <typename T>
+  static bool matches(const T& value, const T& lower_value, const T& upper_value) {
+    return (value >= lower_value) & (value <= upper_value);
+  }
+
+  template <typename Traits, typename Vector>
+  static uint32_t matches_mask(const Vector& values, const Vector& lower_values, const Vector& upper_values) {
+    return Traits::greater_than_equals(values, lower_values) & Traits::less_than_equals(values, upper_values);
+  }
+};
+
+// SimdTraits<T> wraps the intrinsics for one type. All comparisons return a bit mask with one bit per lane.
+template <typename T>
+struct SimdTraits {
+  static constexpr bool available = false;
+};
+
+#if defined(__AVX2__)
+
+template <>
+struct SimdTraits<int32_t> {
+  static constexpr bool available = true;
+  static constexpr ChunkOffset lanes = 8;
+  static constexpr uint32_t all_lanes = 0xFF;
+  using Vector = __m256i;
+
+  static Vector load(const int32_t* values) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)); }
+  static Vector broadcast(const int32_t value) { return _mm256_set1_epi32(value); }
+
+  static uint32_t to_mask(const Vector& vector) { return _mm256_movemask_ps(_mm256_castsi256_ps(vector)); }
+
+  static uint32_t equals(const Vector& lhs, const Vector& rhs) { return to_mask(_mm256_cmpeq_epi32(lhs, rhs)); }
+  static uint32_t not_equals(const Vector& lhs, const Vector& rhs) { return ~equals(lhs, rhs) & all_lanes; }
+  static uint32_t greater_than(const Vector& lhs, const Vector& rhs) { return to_mask(_mm256_cmpgt_epi32(lhs, rhs)); }
+  static uint32_t less_than(const Vector& lhs, const Vector& rhs) { return greater_than(rhs, lhs); }
+  static uint32_t less_than_equals(const Vector& lhs, const Vector& rhs) { return ~greater_than(lhs, rhs) & all_lanes; }
+  static uint32_t greater_than_equals(const Vector& lhs, const Vector& rhs) { return ~less_than(lhs, rhs) & all_lanes; }
+};
+
+template <>
+struct SimdTraits<int64_t> {
+  static constexpr bool available = true;
+  static constexpr ChunkOffset lanes = 4;
+  static constexpr uint32_t all_lanes = 0xF;
+  using Vector = __m256i;
+
+  static Vector load(const int64_t* values) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)); }
+  static Vector broadcast(const int64_t value) { return _mm256_set1_epi64x(value); }
+
+  static uint32_t to_mask(const Vector& vector) { return _mm256_movemask_pd(_mm256_castsi256_pd(vector)); }
+
+  static uint32_t equals(const Vector& lhs, const Vector& rhs) { return to_mask(_mm256_cmpeq_epi64(lhs, rhs)); }
+  static uint32_t not_equals(const Vector& lhs, const Vector& rhs) { return ~equals(lhs, rhs) & all_lanes; }
+  static uint32_t greater_than(const Vector& lhs, const Vector& rhs) { return to_mask(_mm256_cmpgt_epi64(lhs, rhs)); }
+  static uint32_t less_than(const Vector& lhs, const Vector& rhs) { return greater_than(rhs, lhs); }
+  static uint32_t less_than_equals(const Vector& lhs, const Vector& rhs) { return ~greater_than(lhs, rhs) & all_lanes; }
+  static uint32_t greater_than_equals(const Vector& lhs, const Vector& rhs) { return ~less_than(lhs, rhs) & all_lanes; }
+};
+
+template <>
+struct SimdTraits<float> {
+  static constexpr bool available = true;
+  static constexpr ChunkOffset lanes = 8;
+  using Vector = __m256;
+
+  static Vector load(const float* values) { return _mm256_loadu_ps(values); }
+  static Vector broadcast(const float value) { return _mm256_set1_ps(value); }
+
+  static uint32_t equals(const Vector& lhs, const Vector& rhs) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ));
+  }
+  static uint32_t not_equals(const Vector& lhs, const Vector& rhs) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, _CMP_NEQ_UQ));
+  }
+  static uint32_t less_than(const Vector& lhs, const Vector& rhs) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ));
+  }
+  static uint32_t less_than_equals(const Vector& lhs, const Vector& rhs) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, _CMP_LE_OQ));
+  }
+  static uint32_t greater_than(const Vector& lhs, const Vector& rhs) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, _CMP_GT_OQ));
+  }
+  static uint32_t greater_than_equals(const Vector& lhs, const Vector& rhs) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, _CMP_GE_OQ));
+  }
+};
+
+template <>
+struct SimdTraits<double> {
+  static constexpr bool available = true;
+  static constexpr ChunkOffset lanes = 4;
+  using Vector = __m256d;
+
+  static Vector load(const double* values) { return _mm256_loadu_pd(values); }
+  static Vector broadcast(const double value) { return _mm256_set1_pd(value); }
+
+  static uint32_t equals(const Vector& lhs, const Vector& rhs) {
+    return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ));
+  }
+  static uint32_t not_equals(const Vector& lhs, const Vector& rhs) {
+    return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_NEQ_UQ));
+  }
+  static uint32_t less_than(const Vector& lhs, const Vector& rhs) {
+    return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ));
+  }
+  static uint32_t less_than_equals(const Vector& lhs, const Vector& rhs) {
+    return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ));
+  }
+  static uint32_t greater_than(const Vector& lhs, const Vector& rhs) {
+    return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ));
+  }
+  static uint32_t greater_than_equals(const Vector& lhs, const Vector& rhs) {
+    return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ));
+  }
+};
+
+#elif defined(__SSE4_2__)
+
+template <>
+struct SimdTraits<int32_t> {
+  static constexpr bool available = true;
+  static constexpr ChunkOffset lanes = 4;
+  static constexpr uint32_t all_lanes = 0xF;
+  using Vector = __m128i;
+
+  static Vector load(const int32_t* values) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values)); }
+  static Vector broadcast(const int32_t value) { return _mm_set1_epi32(value); }
+
+  static uint32_t to_mask(const Vector& vector) { return _mm_movemask_ps(_mm_castsi128_ps(vector)); }
+
+  static uint32_t equals(const Vector& lhs, const Vector& rhs) { return to_mask(_mm_cmpeq_epi32(lhs, rhs)); }
+  static uint32_t not_equals(const Vector& lhs, const Vector& rhs) { return ~equals(lhs, rhs) & all_lanes; }
+  static uint32_t greater_than(const Vector& lhs, const Vector& rhs) { return to_mask(_mm_cmpgt_epi32(lhs, rhs)); }
+  static uint32_t less_than(const Vector& lhs, const Vector& rhs) { return greater_than(rhs, lhs); }
+  static uint32_t less_than_equals(const Vector& lhs, const Vector& rhs) { return ~greater_than(lhs, rhs) & all_lanes; }
+  static uint32_t greater_than_equals(const Vector& lhs, const Vector& rhs) { return ~less_than(lhs, rhs) & all_lanes; }
+};
+
+template <>
+struct SimdTraits<int64_t> {
+  static constexpr bool available = true;
+  static constexpr ChunkOffset lanes = 2;
+  static constexpr uint32_t all_lanes = 0x3;
+  using Vector = __m128i;
+
+  static Vector load(const int64_t* values) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values)); }
+  static Vector broadcast(const int64_t value) { return _mm_set1_epi64x(value); }
+
+  static uint32_t to_mask(const Vector& vector) { return _mm_movemask_pd(_mm_castsi128_pd(vector)); }
+
+  static uint32_t equals(const Vector& lhs, const Vector& rhs) { return to_mask(_mm_cmpeq_epi64(lhs, rhs)); }
+  static uint32_t not_equals(const Vector& lhs, const Vector& rhs) { return ~equals(lhs, rhs) & all_lanes; }
+  static uint32_t greater_than(const Vector& lhs, const Vector& rhs) { return to_mask(_mm_cmpgt_epi64(lhs, rhs)); }
+  static uint32_t less_than(const Vector& lhs, const Vector& rhs) { return greater_than(rhs, lhs); }
+  static uint32_t less_than_equals(const Vector& lhs, const Vector& rhs) { return ~greater_than(lhs, rhs) & all_lanes; }
+  static uint32_t greater_than_equals(const Vector& lhs, const Vector& rhs) { return ~less_than(lhs, rhs) & all_lanes; }
+};
+
+template <>
+struct SimdTraits<float> {
+  static constexpr bool available = true;
+  static constexpr ChunkOffset lanes = 4;
+  using Vector = __m128;
+
+  static Vector load(const float* values) { return _mm_loadu_ps(values); }
+  static Vector broadcast(const float value) { return _mm_set1_ps(value); }
+
+  static uint32_t equals(const Vector& lhs, const Vector& rhs) { return _mm_movemask_ps(_mm_cmpeq_ps(lhs, rhs)); }
+  static uint32_t not_equals(const Vector& lhs, const Vector& rhs) { return _mm_movemask_ps(_mm_cmpneq_ps(lhs, rhs)); }
+  static uint32_t less_than(const Vector& lhs, const Vector& rhs) { return _mm_movemask_ps(_mm_cmplt_ps(lhs, rhs)); }
+  static uint32_t less_than_equals(const Vector& lhs, const Vector& rhs) {
+    return _mm_movemask_ps(_mm_cmple_ps(lhs, rhs));
+  }
+  static uint32_t greater_than(const Vector& lhs, const Vector& rhs) { return _mm_movemask_ps(_mm_cmpgt_ps(lhs, rhs)); }
+  static uint32_t greater_than_equals(const Vector& lhs, const Vector& rhs) {
+    return _mm_movemask_ps(_mm_cmpge_ps(lhs, rhs));
+  }
+};
+
+template <>
+struct SimdTraits<double> {
+  static constexpr bool available = true;
+  static constexpr ChunkOffset lanes = 2;
+  using Vector = __m128d;
+
+  static Vector load(const double* values) { return _mm_loadu_pd(values); }
+  static Vector broadcast(const double value) { return _mm_set1_pd(value); }
+
+  static uint32_t equals(const Vector& lhs, const Vector& rhs) { return _mm_movemask_pd(_mm_cmpeq_pd(lhs, rhs)); }
+  static uint32_t not_equals(const Vector& lhs, const Vector& rhs) { return _mm_movemask_pd(_mm_cmpneq_pd(lhs, rhs)); }
+  static uint32_t less_than(const Vector& lhs, const Vector& rhs) { return _mm_movemask_pd(_mm_cmplt_pd(lhs, rhs)); }
+  static uint32_t less_than_equals(const Vector& lhs, const Vector& rhs) {
+    return _mm_movemask_pd(_mm_cmple_pd(lhs, rhs));
+  }
+  static uint32_t greater_than(const Vector& lhs, const Vector& rhs) { return _mm_movemask_pd(_mm_cmpgt_pd(lhs, rhs)); }
+  static uint32_t greater_than_equals(const Vector& lhs, const Vector& rhs) {
+    return _mm_movemask_pd(_mm_cmpge_pd(lhs, rhs));
+  }
+};
+
+#endif
+
+template <typename Predicate, typename T>
+void scan_scalar(const T* values, const ChunkOffset begin, const ChunkOffset end, const T& search_value,
+                 const T& search_value2, const ChunkID chunk_id, PosList& pos_list) {
+  auto matches_count = pos_list.size();
+  pos_list.resize(matches_count + (end - begin));
+
+  for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+    pos_list[matches_count] = RowID{chunk_id, chunk_offset};
+    matches_count += Predicate::matches(values[chunk_offset], search_value, search_value2);
+  }
+
+  pos_list.resize(matches_count);
+}
+
+template <typename Predicate, typename T>
+void scan_simd(const T* values, const ChunkOffset size, const T& search_value, const T& search_value2,
+               const ChunkID chunk_id, PosList& pos_list) {
+  using Traits = SimdTraits<T>;
+
+  const auto search_values = Traits::broadcast(search_value);
+  const auto search_values2 = Traits::broadcast(search_value2);
+
+  auto chunk_offset = ChunkOffset{0};
+  for (; chunk_offset + Traits::lanes <= size; chunk_offset += Traits::lanes) {
+    const auto block = Traits::load(values + chunk_offset);
+    auto mask = Predicate::template matches_mask<Traits>(block, search_values, search_values2);
+
+    while (mask) {
+      pos_list.emplace_back(RowID{chunk_id, chunk_offset + static_cast<ChunkOffset>(__builtin_ctz(mask))});
+      mask &= mask - 1;
+    }
+  }
+
+  scan_scalar<Predicate>(values, chunk_offset, size, search_value, search_value2, chunk_id, pos_list);
+}
+
+}  // namespace detail
+
+// Resolves the scan type by passing a predicate object, which offers matches() and matches_mask(), to a generic lambda
+template <typename Functor>
+void with_scan_predicate(const ScanType scan_type, const Functor& func) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return func(detail::ScanEquals{});
+    case ScanType::OpNotEquals:
+      return func(detail::ScanNotEquals{});
+    case ScanType::OpLessThan:
+      return func(detail::ScanLessThan{});
+    case ScanType::OpLessThanEquals:
+      return func(detail::ScanLessThanEquals{});
+    case ScanType::OpGreaterThan:
+      return func(detail::ScanGreaterThan{});
+    case ScanType::OpGreaterThanEquals:
+      return func(detail::ScanGreaterThanEquals{});
+    case ScanType::OpBetween:
+      return func(detail::ScanBetween{});
+  }
+  Fail("Unknown scan type");
+}
+
+// Appends the positions of all values that satisfy the scan to pos_list. search_value2 is only used by OpBetween.
+template <typename T>
+void scan_values(const T* values, const ChunkOffset size, const ScanType scan_type, const T& search_value,
+                 const T& search_value2, const ChunkID chunk_id, PosList& pos_list) {
+  with_scan_predicate(scan_type, [&](auto predicate) {
+    using Predicate = decltype(predicate);
+
+    if constexpr (detail::SimdTraits<T>::available) {
+      detail::scan_simd<Predicate>(values, size, search_value, search_value2, chunk_id, pos_list);
+    } else {
+      detail::scan_scalar<Predicate>(values, ChunkOffset{0}, size, search_value, search_value2, chunk_id, pos_list);
+    }
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,167 @@
+#include "sort.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "multiway_merge.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/for_each_value.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/normalized_key.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+struct SortElement {
+  T value;
+  RowID row_id;
+};
+
+// sorts the rows of the input by a single column, comparing its typed values
+template <typename T>
+void sort_by_column(const Table& table, const SortColumnDefinition& definition, PosList& pos_list) {
+  const auto descending = is_descending(definition.order_by_mode);
+
+  // ties are broken by the position, which keeps the input order of equal rows
+  const auto compare = [descending](const SortElement<T>& left, const SortElement<T>& right) {
+    if (left.value < right.value) return !descending;
+    if (right.value < left.value) return descending;
+    return left.row_id < right.row_id;
+  };
+
+  std::vector<std::vector<SortElement<T>>> runs(table.chunk_count());
+  std::vector<PosList> null_pos_lists(table.chunk_count());
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& run = runs[chunk_id];
+      run.reserve(chunk.size());
+      for_each_value_or_null<T>(
+          *chunk.get_column(definition.column_id),
+          [&](const T& value, const ChunkOffset offset) {
+            run.push_back(SortElement<T>{value, RowID{chunk_id, offset}});
+          },
+          [&](const ChunkOffset offset) { null_pos_lists[chunk_id].push_back(RowID{chunk_id, offset}); });
+      std::sort(run.begin(), run.end(), compare);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  const auto sorted_elements = multiway_merge(runs, compare);
+
+  const auto append_nulls = [&]() {
+    for (const auto& null_pos_list : null_pos_lists) {
+      pos_list.insert(pos_list.end(), null_pos_list.cbegin(), null_pos_list.cend());
+    }
+  };
+
+  if (!is_nulls_last(definition.order_by_mode)) append_nulls();
+  for (const auto& element : sorted_elements) pos_list.push_back(element.row_id);
+  if (is_nulls_last(definition.order_by_mode)) append_nulls();
+}
+
+// Sorts the rows of the input by multiple columns. The key of each row consists of the normalized keys of its sort
+// column values, each preceded by a byte that orders NULLs (which have no value key) before or after all values.
+void sort_by_normalized_keys(const Table& table, const std::vector<SortColumnDefinition>& definitions,
+                             PosList& pos_list) {
+  const auto compare = [](const SortElement<std::string>& left, const SortElement<std::string>& right) {
+    const auto comparison = left.value.compare(right.value);
+    return comparison < 0 || (comparison == 0 && left.row_id < right.row_id);
+  };
+
+  std::vector<std::vector<SortElement<std::string>>> runs(table.chunk_count());
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      std::vector<std::string> keys(chunk.size());
+
+      for (const auto& definition : definitions) {
+        const auto descending = is_descending(definition.order_by_mode);
+        const auto null_marker = is_nulls_last(definition.order_by_mode) ? '\x02' : '\x00';
+
+        resolve_data_type(table.column_type(definition.column_id), [&](auto type) {
+          using Type = typename decltype(type)::type;
+          for_each_value_or_null<Type>(
+              *chunk.get_column(definition.column_id),
+              [&](const Type& value, const ChunkOffset offset) {
+                keys[offset].push_back('\x01');
+                append_normalized_key(keys[offset], value, descending);
+              },
+              [&](const ChunkOffset offset) { keys[offset].push_back(null_marker); });
+        });
+      }
+
+      auto& run = runs[chunk_id];
+      run.reserve(chunk.size());
+      for (ChunkOffset offset{0}; offset < chunk.size(); ++offset) {
+        run.push_back(SortElement<std::string>{std::move(keys[offset]), RowID{chunk_id, offset}});
+      }
+      std::sort(run.begin(), run.end(), compare);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  const auto sorted_elements = multiway_merge(runs, compare);
+  for (const auto& element : sorted_elements) pos_list.push_back(element.row_id);
+}
+
+}  // namespace
+
+bool is_descending(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+}
+
+bool is_nulls_last(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::AscendingNullsLast || order_by_mode == OrderByMode::DescendingNullsLast;
+}
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions)
+    : AbstractOperator(in), _sort_definitions(sort_definitions) {
+  Assert(!sort_definitions.empty(), "Sort needs at least one sort column");
+}
+
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return this->_sort_definitions; }
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = this->_input_table_left();
+
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->reserve(input_table->row_count());
+
+  if (this->_sort_definitions.size() == 1) {
+    const auto& definition = this->_sort_definitions.front();
+    resolve_data_type(input_table->column_type(definition.column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      sort_by_column<Type>(*input_table, definition, *pos_list);
+    });
+  } else {
+    sort_by_normalized_keys(*input_table, this->_sort_definitions, *pos_list);
+  }
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->column_names().size(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  Chunk output_chunk;
+  this->_add_reference_columns(output_chunk, input_table, pos_list);
+  output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+struct SortColumnDefinition {
+  ColumnID column_id;
+  OrderByMode order_by_mode = OrderByMode::Ascending;
+};
+
+bool is_descending(const OrderByMode order_by_mode);
+bool is_nulls_last(const OrderByMode order_by_mode);
+
+// Sort orders the input by one or more columns, the first definition being the most significant one. Rows that are
+// equal in all sort columns keep their input order.
+// Each chunk is sorted by its own job, and the sorted chunks are combined by a parallel multiway merge. A single sort
+// column is sorted on its typed values. For multiple sort columns, the values of each row are combined into a
+// normalized key (see normalized_key.hpp), so that rows are compared with a single memcmp instead of column by column.
+// The output is a single chunk of ReferenceColumns that share a PosList in the sorted order.
+class Sort : public AbstractOperator {
+ public:
+  Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+};
+
+}  // namespace opossum
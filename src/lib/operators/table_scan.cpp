@@ -0,0 +1,288 @@
+#include "table_scan.hpp"
+
+#include <optional>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scan_kernels.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "storage/zone_map.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Appends the positions of all matching rows of a chunk using an index over the scanned column (or over columns
+// starting with it). Every scan type translates into one range of the index, or two for OpNotEquals. The index
+// returns the offsets in value order, so they are sorted to keep the output ordered by offset.
+void scan_index(const BaseIndex& index, const ScanType scan_type, const AllTypeVariant& search_value,
+                const std::optional<AllTypeVariant>& search_value2, const ChunkID chunk_id, PosList& pos_list) {
+  const auto lower_bound = [&](const AllTypeVariant& value) { return index.lower_bound({value}); };
+  const auto upper_bound = [&](const AllTypeVariant& value) { return index.upper_bound({value}); };
+
+  auto begin = index.cbegin();
+  auto end = index.cend();
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      begin = lower_bound(search_value);
+      end = upper_bound(search_value);
+      break;
+    case ScanType::OpNotEquals:
+      // the rows before the equal ones, the rows after them are added below
+      end = lower_bound(search_value);
+      break;
+    case ScanType::OpLessThan:
+      end = lower_bound(search_value);
+      break;
+    case ScanType::OpLessThanEquals:
+      end = upper_bound(search_value);
+      break;
+    case ScanType::OpGreaterThan:
+      begin = upper_bound(search_value);
+      break;
+    case ScanType::OpGreaterThanEquals:
+      begin = lower_bound(search_value);
+      break;
+    case ScanType::OpBetween:
+      begin = lower_bound(search_value);
+      end = std::max(begin, upper_bound(*search_value2));
+      break;
+  }
+
+  std::vector<ChunkOffset> offsets(begin, end);
+  if (scan_type == ScanType::OpNotEquals) offsets.insert(offsets.end(), upper_bound(search_value), index.cend());
+  std::sort(offsets.begin(), offsets.end());
+
+  pos_list.reserve(pos_list.size() + offsets.size());
+  for (const auto chunk_offset : offsets) pos_list.emplace_back(RowID{chunk_id, chunk_offset});
+}
+
+}  // namespace
+
+// BaseTableScanImpl is the non-templated base of the typed scan implementation, which is chosen once per scan
+class BaseTableScanImpl {
+ public:
+  virtual ~BaseTableScanImpl() = default;
+
+  // appends the positions of all matching rows of the given column of a chunk
+  // positions refer to the scanned table, even if it is a reference table
+  virtual void scan_column(const BaseColumn& column, const ChunkID chunk_id, PosList& pos_list) const = 0;
+
+  // returns whether a chunk with the given zone map of the scanned column may contain matches
+  virtual bool may_match(const ZoneMap& zone_map) const = 0;
+};
+
+template <typename T>
+class TableScanImpl : public BaseTableScanImpl {
+ public:
+  TableScanImpl(const ScanType scan_type, const AllTypeVariant& search_value,
+                const std::optional<AllTypeVariant>& search_value2)
+      : _scan_type(scan_type),
+        _search_value(type_cast<T>(search_value)),
+        _search_value2(search_value2 ? type_cast<T>(*search_value2) : T{}) {}
+
+  void scan_column(const BaseColumn& column, const ChunkID chunk_id, PosList& pos_list) const override {
+    if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+      this->_scan_value_column(*value_column, chunk_id, pos_list);
+    } else if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+      this->_scan_dictionary_column(*dictionary_column, chunk_id, pos_list);
+    } else if (const auto reference_column = dynamic_cast<const ReferenceColumn*>(&column)) {
+      this->_scan_reference_column(*reference_column, chunk_id, pos_list);
+    } else {
+      Fail("TableScan does not support this column type");
+    }
+  }
+
+  bool may_match(const ZoneMap& zone_map) const override {
+    return zone_map_may_match(zone_map, this->_scan_type, this->_search_value, this->_search_value2);
+  }
+
+ protected:
+  void _scan_value_column(const ValueColumn<T>& column, const ChunkID chunk_id, PosList& pos_list) const {
+    scan_values(column.data(), static_cast<ChunkOffset>(column.size()), this->_scan_type, this->_search_value,
+                this->_search_value2, chunk_id, pos_list);
+  }
+
+  // Dictionary columns are scanned on their value ids. As the dictionary is sorted, every scan type translates
+  // into a range [lower_value_id, upper_value_id) of matching value ids, or, for OpNotEquals, its complement.
+  void _scan_dictionary_column(const DictionaryColumn<T>& column, const ChunkID chunk_id, PosList& pos_list) const {
+    const auto unique_values_count = static_cast<ValueID::base_type>(column.unique_values_count());
+    const auto bound = [&](const ValueID value_id) {
+      return value_id == INVALID_VALUE_ID ? unique_values_count : static_cast<ValueID::base_type>(value_id);
+    };
+
+    auto lower_value_id = ValueID::base_type{0};
+    auto upper_value_id = unique_values_count;
+    auto negate = false;
+
+    switch (this->_scan_type) {
+      case ScanType::OpEquals:
+      case ScanType::OpNotEquals:
+        lower_value_id = bound(column.lower_bound(this->_search_value));
+        upper_value_id = bound(column.upper_bound(this->_search_value));
+        negate = this->_scan_type == ScanType::OpNotEquals;
+        break;
+      case ScanType::OpLessThan:
+        upper_value_id = bound(column.lower_bound(this->_search_value));
+        break;
+      case ScanType::OpLessThanEquals:
+        upper_value_id = bound(column.upper_bound(this->_search_value));
+        break;
+      case ScanType::OpGreaterThan:
+        lower_value_id = bound(column.upper_bound(this->_search_value));
+        break;
+      case ScanType::OpGreaterThanEquals:
+        lower_value_id = bound(column.lower_bound(this->_search_value));
+        break;
+      case ScanType::OpBetween:
+        lower_value_id = bound(column.lower_bound(this->_search_value));
+        upper_value_id = bound(column.upper_bound(this->_search_value2));
+        break;
+    }
+
+    if (lower_value_id >= upper_value_id && !negate) return;
+
+    // value_id - lower_value_id wraps around for value ids below the range, so one comparison checks both bounds
+    const auto range_size = upper_value_id > lower_value_id ? upper_value_id - lower_value_id : 0u;
+    resolve_attribute_vector(*column.attribute_vector(), [&](const auto& attribute_vector) {
+      const auto size = static_cast<ChunkOffset>(attribute_vector.size());
+      auto matches_count = pos_list.size();
+      pos_list.resize(matches_count + size);
+
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+        const auto value_id = static_cast<ValueID::base_type>(attribute_vector.get(chunk_offset));
+        pos_list[matches_count] = RowID{chunk_id, chunk_offset};
+        matches_count += (value_id - lower_value_id < range_size) != negate;
+      }
+
+      pos_list.resize(matches_count);
+    });
+  }
+
+  // Reference columns are scanned position by position. The referenced column is looked up once per run of
+  // positions within the same referenced chunk.
+  void _scan_reference_column(const ReferenceColumn& column, const ChunkID chunk_id, PosList& pos_list) const {
+    const auto& referenced_table = *column.referenced_table();
+    const auto& referenced_positions = *column.pos_list();
+
+    with_scan_predicate(this->_scan_type, [&](auto predicate) {
+      using Predicate = decltype(predicate);
+
+      auto current_chunk_id = ChunkID{INVALID_CHUNK_ID};
+      const ValueColumn<T>* value_column = nullptr;
+      const DictionaryColumn<T>* dictionary_column = nullptr;
+
+      for (ChunkOffset chunk_offset{0}; chunk_offset < referenced_positions.size(); ++chunk_offset) {
+        const auto& row_id = referenced_positions[chunk_offset];
+        // rows without a value never match
+        if (row_id == NULL_ROW_ID) continue;
+
+        if (row_id.chunk_id != current_chunk_id) {
+          current_chunk_id = row_id.chunk_id;
+          const auto& referenced_column =
+              *referenced_table.get_chunk(current_chunk_id).get_column(column.referenced_column_id());
+          value_column = dynamic_cast<const ValueColumn<T>*>(&referenced_column);
+          dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&referenced_column);
+          Assert(value_column || dictionary_column, "TableScan does not support this referenced column type");
+        }
+
+        const auto value =
+            value_column ? value_column->get_typed(row_id.chunk_offset) : dictionary_column->get(row_id.chunk_offset);
+        if (Predicate::matches(value, this->_search_value, this->_search_value2)) {
+          pos_list.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+    });
+  }
+
+  const ScanType _scan_type;
+  const T _search_value;
+  const T _search_value2;
+};
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant search_value, const std::optional<AllTypeVariant> search_value2)
+    : AbstractOperator(in),
+      _column_id(column_id),
+      _scan_type(scan_type),
+      _search_value(search_value),
+      _search_value2(search_value2) {
+  Assert(scan_type != ScanType::OpBetween || search_value2, "OpBetween needs two search values");
+}
+
+ColumnID TableScan::column_id() const { return this->_column_id; }
+
+ScanType TableScan::scan_type() const { return this->_scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return this->_search_value; }
+
+const std::optional<AllTypeVariant>& TableScan::search_value2() const { return this->_search_value2; }
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = this->_input_table_left();
+  const auto& column_type = input_table->column_type(this->_column_id);
+  const auto impl = make_unique_by_column_type<BaseTableScanImpl, TableScanImpl>(
+      column_type, this->_scan_type, this->_search_value, this->_search_value2);
+
+  // chunks are scanned in parallel, each into its own PosList
+  std::vector<PosList> chunk_pos_lists(input_table->chunk_count());
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto& chunk = input_table->get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    // chunks whose value range cannot match are skipped without looking at their values
+    const auto& zone_map = chunk.zone_map(this->_column_id);
+    if (zone_map && !impl->may_match(*zone_map)) continue;
+
+    // point and range lookups use an index of the chunk if there is one
+    const auto indices = chunk.get_indices_for({this->_column_id});
+    if (!indices.empty()) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, index = indices.front()]() {
+        scan_index(*index, this->_scan_type, this->_search_value, this->_search_value2, chunk_id,
+                   chunk_pos_lists[chunk_id]);
+      }));
+      continue;
+    }
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      impl->scan_column(*chunk.get_column(this->_column_id), chunk_id, chunk_pos_lists[chunk_id]);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto pos_list = std::make_shared<PosList>();
+  auto matches_count = size_t{0};
+  for (const auto& chunk_pos_list : chunk_pos_lists) matches_count += chunk_pos_list.size();
+  pos_list->reserve(matches_count);
+  for (const auto& chunk_pos_list : chunk_pos_lists) {
+    pos_list->insert(pos_list->end(), chunk_pos_list.cbegin(), chunk_pos_list.cend());
+  }
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->column_names().size(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  Chunk output_chunk;
+  this->_add_reference_columns(output_chunk, input_table, pos_list);
+  output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+}  // namespace opossum
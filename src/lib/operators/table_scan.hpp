@@ -0,0 +1,39 @@
+#pragma once
+
+#include <optional>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// TableScan returns all rows of the input whose value in the given column satisfies the scan condition, e.g.,
+// column < search_value. For OpBetween, search_value2 is the (inclusive) upper bound.
+// Chunks whose zone map shows that none of their values can match are skipped. Chunks with an index over the scanned
+// column (see Chunk::create_index()) are scanned by looking up the matching range in the index.
+// The output is a table of ReferenceColumns that share a single PosList, ordered by chunk and offset.
+class TableScan : public AbstractOperator {
+ public:
+  TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+            const AllTypeVariant search_value, const std::optional<AllTypeVariant> search_value2 = std::nullopt);
+
+  ColumnID column_id() const;
+  ScanType scan_type() const;
+  const AllTypeVariant& search_value() const;
+  const std::optional<AllTypeVariant>& search_value2() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+  const std::optional<AllTypeVariant> _search_value2;
+};
+
+}  // namespace opossum
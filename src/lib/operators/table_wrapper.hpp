@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// operator to wrap a table, e.g., to use it as the input of other operators
+class TableWrapper : public AbstractOperator {
+ public:
+  explicit TableWrapper(const std::shared_ptr<const Table> table);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // Table to retrieve
+  const std::shared_ptr<const Table> _table;
+};
+
+}  // namespace opossum
@@ -0,0 +1,128 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/for_each_value.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+struct TopKElement {
+  bool is_null;
+  T value;
+  RowID row_id;
+};
+
+template <typename T>
+void top_k_by_column(const Table& table, const SortColumnDefinition& definition, const size_t limit,
+                     PosList& pos_list) {
+  const auto descending = is_descending(definition.order_by_mode);
+  const auto nulls_last = is_nulls_last(definition.order_by_mode);
+
+  // returns whether a row, whose value is only borrowed, comes before an element, ties are broken by the position
+  const auto comes_before = [descending, nulls_last](const bool is_null, const T& value, const RowID& row_id,
+                                                     const TopKElement<T>& element) {
+    if (is_null != element.is_null) return is_null != nulls_last;
+    if (!is_null) {
+      if (value < element.value) return !descending;
+      if (element.value < value) return descending;
+    }
+    return row_id < element.row_id;
+  };
+  const auto compare = [&comes_before](const TopKElement<T>& left, const TopKElement<T>& right) {
+    return comes_before(left.is_null, left.value, left.row_id, right);
+  };
+
+  // With compare as the ordering, each heap is a max-heap, i.e., its front is the worst element kept so far and
+  // the first to be replaced by a better one.
+  std::vector<std::vector<TopKElement<T>>> heaps(table.chunk_count());
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& heap = heaps[chunk_id];
+      heap.reserve(std::min(limit, static_cast<size_t>(chunk.size())));
+
+      // once the heap is full, most rows are worse than its front, so they are compared before anything is copied
+      const auto offer = [&](const bool is_null, const T& value, const RowID row_id) {
+        if (heap.size() < limit) {
+          heap.push_back(TopKElement<T>{is_null, value, row_id});
+          std::push_heap(heap.begin(), heap.end(), compare);
+        } else if (comes_before(is_null, value, row_id, heap.front())) {
+          std::pop_heap(heap.begin(), heap.end(), compare);
+          // assigning to the replaced element reuses its memory, e.g., the buffer of a string
+          auto& element = heap.back();
+          element.is_null = is_null;
+          element.value = value;
+          element.row_id = row_id;
+          std::push_heap(heap.begin(), heap.end(), compare);
+        }
+      };
+
+      const auto null_value = T{};
+      for_each_value_or_null<T>(
+          *chunk.get_column(definition.column_id),
+          [&](const T& value, const ChunkOffset offset) { offer(false, value, RowID{chunk_id, offset}); },
+          [&](const ChunkOffset offset) { offer(true, null_value, RowID{chunk_id, offset}); });
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // at most limit * chunk_count candidates are left, of which only the best ones are sorted
+  std::vector<TopKElement<T>> candidates;
+  for (auto& heap : heaps) {
+    std::move(heap.begin(), heap.end(), std::back_inserter(candidates));
+  }
+  const auto result_size = std::min(limit, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + result_size, candidates.end(), compare);
+
+  pos_list.reserve(result_size);
+  for (size_t index = 0; index < result_size; ++index) pos_list.push_back(candidates[index].row_id);
+}
+
+}  // namespace
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator> in, const SortColumnDefinition& sort_definition,
+           const size_t limit)
+    : AbstractOperator(in), _sort_definition(sort_definition), _limit(limit) {}
+
+const SortColumnDefinition& TopK::sort_definition() const { return this->_sort_definition; }
+
+size_t TopK::limit() const { return this->_limit; }
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = this->_input_table_left();
+
+  auto pos_list = std::make_shared<PosList>();
+  if (this->_limit > 0) {
+    resolve_data_type(input_table->column_type(this->_sort_definition.column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      top_k_by_column<Type>(*input_table, this->_sort_definition, this->_limit, *pos_list);
+    });
+  }
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->column_names().size(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  Chunk output_chunk;
+  this->_add_reference_columns(output_chunk, input_table, pos_list);
+  output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+}  // namespace opossum
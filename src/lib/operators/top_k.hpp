@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// TopK returns the first `limit` rows of the input in the order given by a sort column, i.e., it is equivalent to a
+// Sort followed by a LIMIT, but never sorts the whole input. Each chunk keeps the best `limit` rows it has seen in a
+// bounded heap, so that the cost is O(n log k) instead of O(n log n). Only the candidates of all chunks are sorted at
+// the end. As in Sort, equal rows keep their input order.
+// The output is a single chunk of ReferenceColumns that share a PosList in the sorted order.
+class TopK : public AbstractOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator> in, const SortColumnDefinition& sort_definition,
+       const size_t limit);
+
+  const SortColumnDefinition& sort_definition() const;
+  size_t limit() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const SortColumnDefinition _sort_definition;
+  const size_t _limit;
+};
+
+}  // namespace opossum
@@ -7,11 +7,13 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "all_type_variant.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/dictionary_column.hpp"
 #include "storage/value_column.hpp"
 
 namespace opossum {
@@ -129,4 +131,59 @@ void resolve_data_type(const std::string& type_string, const Functor& func) {
   });
 }
 
+/**
+ * Resolves the data type of a ValueColumn or DictionaryColumn by its class and passes a hana::type object on to a
+ * generic lambda, like resolve_data_type(). This is for code that only has the column, e.g., an index, but not the
+ * column type of its table. Other columns (i.e., ReferenceColumns) fail.
+ */
+template <typename Functor>
+void resolve_column_data_type(const BaseColumn& column, const Functor& func) {
+  auto resolved = false;
+  hana::for_each(types, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    if (resolved) return;
+    if (dynamic_cast<const ValueColumn<Type>*>(&column) || dynamic_cast<const DictionaryColumn<Type>*>(&column)) {
+      resolved = true;
+      func(type);
+    }
+  });
+  Assert(resolved, "Column is neither a ValueColumn nor a DictionaryColumn");
+}
+
+/**
+ * Resolves the types of two columns whose values are compared with each other, e.g., the join columns of a join, and
+ * passes hana::type objects for the left type, the right type, and the type to compare them as on to a generic lambda.
+ * Columns of the same type are compared as that type, int and long columns as long (int64_t), and float and double
+ * columns as double. All other combinations cannot be compared.
+ *
+ * Example:
+ *
+ *   resolve_comparable_data_types(left_type, right_type, [&](auto left, auto right, auto common) {
+ *     using CommonType = typename decltype(common)::type;
+ *     const auto left_value = static_cast<CommonType>(left_column.get_typed(0));
+ *     ...
+ *   });
+ */
+template <typename Functor>
+void resolve_comparable_data_types(const std::string& left_type_string, const std::string& right_type_string,
+                                   const Functor& func) {
+  resolve_data_type(left_type_string, [&](auto left_type) {
+    using LeftType = typename decltype(left_type)::type;
+
+    resolve_data_type(right_type_string, [&](auto right_type) {
+      using RightType = typename decltype(right_type)::type;
+
+      if constexpr (std::is_same_v<LeftType, RightType>) {
+        func(left_type, right_type, left_type);
+      } else if constexpr (std::is_integral_v<LeftType> && std::is_integral_v<RightType>) {
+        func(left_type, right_type, hana::type_c<int64_t>);
+      } else if constexpr (std::is_floating_point_v<LeftType> && std::is_floating_point_v<RightType>) {
+        func(left_type, right_type, hana::type_c<double>);
+      } else {
+        Fail("Columns of type " + left_type_string + " and " + right_type_string + " cannot be compared");
+      }
+    });
+  });
+}
+
 }  // namespace opossum
@@ -0,0 +1,54 @@
+#include "abstract_task.hpp"
+
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include "current_scheduler.hpp"
+#include "task_scheduler.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void AbstractTask::schedule() {
+  const auto was_scheduled = this->_is_scheduled.exchange(true);
+  Assert(!was_scheduled, "Task was already scheduled");
+
+  if (CurrentScheduler::is_set()) {
+    CurrentScheduler::get()->schedule(this->shared_from_this());
+  } else {
+    this->execute();
+  }
+}
+
+void AbstractTask::execute() {
+  DebugAssert(!this->is_done(), "Task was already executed");
+
+  try {
+    this->_on_execute();
+  } catch (...) {
+    this->_exception = std::current_exception();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(this->_done_mutex);
+    this->_is_done = true;
+  }
+  this->_done_condition_variable.notify_all();
+}
+
+bool AbstractTask::is_done() const { return this->_is_done; }
+
+void AbstractTask::wait() {
+  std::unique_lock<std::mutex> lock(this->_done_mutex);
+  this->_done_condition_variable.wait(lock, [&]() { return this->is_done(); });
+}
+
+void AbstractTask::join() {
+  this->wait();
+  if (this->_exception) std::rethrow_exception(this->_exception);
+}
+
+std::exception_ptr AbstractTask::exception() const { return this->is_done() ? this->_exception : nullptr; }
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// AbstractTask is the abstract super class for all units of work that can be run by the TaskScheduler,
+// e.g., JobTask. A task is executed exactly once, either by a worker of the scheduler or, if no scheduler is set,
+// right away by the thread that schedules it.
+// Exceptions thrown by a task, e.g., by a failed Assert, do not escape the thread that executes it. They are stored
+// and rethrown by join(), so that they reach the thread that waits for the task.
+class AbstractTask : public std::enable_shared_from_this<AbstractTask>, private Noncopyable {
+ public:
+  AbstractTask() = default;
+  virtual ~AbstractTask() = default;
+
+  // hands the task to the current scheduler, or executes it in the calling thread if there is none
+  void schedule();
+
+  // runs the task in the calling thread and wakes up threads waiting for it
+  void execute();
+
+  // returns whether the task has finished
+  bool is_done() const;
+
+  // blocks the calling thread until the task has finished
+  void wait();
+
+  // blocks the calling thread until the task has finished and rethrows the exception that the task threw, if any
+  void join();
+
+  // returns the exception that the task threw, nullptr if it did not throw or has not finished yet
+  std::exception_ptr exception() const;
+
+ protected:
+  virtual void _on_execute() = 0;
+
+ private:
+  std::atomic_bool _is_scheduled{false};
+  std::atomic_bool _is_done{false};
+  // written before _is_done is set, so it is visible to all threads that saw the task finish
+  std::exception_ptr _exception;
+  std::mutex _done_mutex;
+  std::condition_variable _done_condition_variable;
+};
+
+}  // namespace opossum
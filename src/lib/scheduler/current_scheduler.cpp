@@ -0,0 +1,35 @@
+#include "current_scheduler.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "task_scheduler.hpp"
+
+namespace opossum {
+
+std::shared_ptr<TaskScheduler> CurrentScheduler::_instance;
+
+const std::shared_ptr<TaskScheduler>& CurrentScheduler::get() { return _instance; }
+
+void CurrentScheduler::set(const std::shared_ptr<TaskScheduler>& instance) {
+  if (_instance) _instance->finish();
+  _instance = instance;
+}
+
+bool CurrentScheduler::is_set() { return _instance != nullptr; }
+
+void CurrentScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  for (const auto& task : tasks) {
+    task->schedule();
+  }
+
+  if (_instance) {
+    _instance->wait_for_tasks(tasks);
+  } else {
+    // the tasks were executed right away, so this only rethrows the first exception
+    for (const auto& task : tasks) task->join();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace opossum {
+
+class AbstractTask;
+class TaskScheduler;
+
+// CurrentScheduler holds the TaskScheduler that is used by all operators. If no scheduler is set (the default, e.g.,
+// in most tests), tasks are executed right away by the thread that schedules them.
+class CurrentScheduler {
+ public:
+  static const std::shared_ptr<TaskScheduler>& get();
+
+  // sets the scheduler. A previously set scheduler finishes its tasks first. Pass nullptr to disable scheduling.
+  // This is not thread-safe and is meant to be called at startup or in between tests.
+  static void set(const std::shared_ptr<TaskScheduler>& instance);
+
+  static bool is_set();
+
+  // schedules all tasks and blocks until they are done, then rethrows the exception of the first task that threw one
+  static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+ private:
+  static std::shared_ptr<TaskScheduler> _instance;
+};
+
+}  // namespace opossum
@@ -0,0 +1,11 @@
+#include "job_task.hpp"
+
+#include <functional>
+
+namespace opossum {
+
+JobTask::JobTask(const std::function<void()>& fn) : _fn(fn) {}
+
+void JobTask::_on_execute() { this->_fn(); }
+
+}  // namespace opossum
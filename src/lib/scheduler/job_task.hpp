@@ -0,0 +1,29 @@
+#pragma once
+
+#include <functional>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+// JobTask wraps an arbitrary function, e.g., a lambda that processes a single chunk
+//
+// Example:
+//
+//   std::vector<std::shared_ptr<AbstractTask>> jobs;
+//   for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+//     jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() { process(table.get_chunk(chunk_id)); }));
+//   }
+//   CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+class JobTask : public AbstractTask {
+ public:
+  explicit JobTask(const std::function<void()>& fn);
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  const std::function<void()> _fn;
+};
+
+}  // namespace opossum
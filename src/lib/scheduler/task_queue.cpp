@@ -0,0 +1,34 @@
+#include "task_queue.hpp"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+void TaskQueue::push(const std::shared_ptr<AbstractTask>& task) {
+  std::lock_guard<std::mutex> lock(this->_mutex);
+  this->_tasks.push_back(task);
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::pull() {
+  std::lock_guard<std::mutex> lock(this->_mutex);
+  if (this->_tasks.empty()) return nullptr;
+
+  auto task = std::move(this->_tasks.back());
+  this->_tasks.pop_back();
+  return task;
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::steal() {
+  std::lock_guard<std::mutex> lock(this->_mutex);
+  if (this->_tasks.empty()) return nullptr;
+
+  auto task = std::move(this->_tasks.front());
+  this->_tasks.pop_front();
+  return task;
+}
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+// TaskQueue is the double-ended queue each worker of the TaskScheduler owns. The owning worker takes the most
+// recently pushed task from the back, which is likely still in its cache. Idle workers steal the oldest task from
+// the front, where they interfere least with the owner.
+class TaskQueue : private Noncopyable {
+ public:
+  // adds a task to the back of the queue
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  // takes the task at the back of the queue, returns nullptr if the queue is empty
+  std::shared_ptr<AbstractTask> pull();
+
+  // takes the task at the front of the queue, returns nullptr if the queue is empty
+  std::shared_ptr<AbstractTask> steal();
+
+ protected:
+  std::deque<std::shared_ptr<AbstractTask>> _tasks;
+  std::mutex _mutex;
+};
+
+}  // namespace opossum
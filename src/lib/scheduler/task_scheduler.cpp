@@ -0,0 +1,121 @@
+#include "task_scheduler.hpp"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "task_queue.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// identifies the scheduler and queue of the calling thread if it is a worker
+thread_local const TaskScheduler* current_worker_scheduler = nullptr;
+thread_local uint32_t current_worker_id = 0;
+
+}  // namespace
+
+TaskScheduler::TaskScheduler(const uint32_t worker_count) {
+  Assert(worker_count > 0, "TaskScheduler needs at least one worker");
+
+  for (uint32_t worker_id = 0; worker_id < worker_count; ++worker_id) {
+    this->_queues.emplace_back(std::make_unique<TaskQueue>());
+  }
+
+  for (uint32_t worker_id = 0; worker_id < worker_count; ++worker_id) {
+    this->_workers.emplace_back([this, worker_id]() { this->_work(worker_id); });
+  }
+}
+
+TaskScheduler::~TaskScheduler() { this->finish(); }
+
+void TaskScheduler::schedule(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(!this->_shutdown, "Cannot schedule tasks after the scheduler has finished");
+
+  auto queue_id = this->_current_worker_id();
+  if (queue_id == this->worker_count()) {
+    queue_id = this->_next_queue_id++ % this->worker_count();
+  }
+
+  this->_queues[queue_id]->push(task);
+  ++this->_queued_tasks_count;
+
+  // taking the lock makes sure that no worker is between checking for tasks and going to sleep
+  { std::lock_guard<std::mutex> lock(this->_sleep_mutex); }
+  this->_sleep_condition_variable.notify_one();
+}
+
+void TaskScheduler::wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  // all tasks have to finish before an exception is rethrown, as they may refer to the state of the caller
+  const auto worker_id = this->_current_worker_id();
+  if (worker_id == this->worker_count()) {
+    for (const auto& task : tasks) task->wait();
+  } else {
+    for (const auto& task : tasks) {
+      while (!task->is_done()) {
+        if (const auto other_task = this->_next_task(worker_id)) {
+          other_task->execute();
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    }
+  }
+
+  for (const auto& task : tasks) task->join();
+}
+
+void TaskScheduler::finish() {
+  if (this->_shutdown.exchange(true)) return;
+
+  { std::lock_guard<std::mutex> lock(this->_sleep_mutex); }
+  this->_sleep_condition_variable.notify_all();
+
+  for (auto& worker : this->_workers) {
+    worker.join();
+  }
+}
+
+uint32_t TaskScheduler::worker_count() const { return static_cast<uint32_t>(this->_queues.size()); }
+
+void TaskScheduler::_work(const uint32_t worker_id) {
+  current_worker_scheduler = this;
+  current_worker_id = worker_id;
+
+  while (true) {
+    if (const auto task = this->_next_task(worker_id)) {
+      task->execute();
+      continue;
+    }
+
+    // only stop once all queues are drained
+    if (this->_shutdown) break;
+
+    std::unique_lock<std::mutex> lock(this->_sleep_mutex);
+    this->_sleep_condition_variable.wait_for(lock, std::chrono::milliseconds(10), [&]() {
+      return this->_shutdown || this->_queued_tasks_count > 0;
+    });
+  }
+}
+
+std::shared_ptr<AbstractTask> TaskScheduler::_next_task(const uint32_t worker_id) {
+  auto task = this->_queues[worker_id]->pull();
+
+  for (uint32_t offset = 1; !task && offset < this->worker_count(); ++offset) {
+    task = this->_queues[(worker_id + offset) % this->worker_count()]->steal();
+  }
+
+  if (task) --this->_queued_tasks_count;
+  return task;
+}
+
+uint32_t TaskScheduler::_current_worker_id() const {
+  return current_worker_scheduler == this ? current_worker_id : this->worker_count();
+}
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class TaskQueue;
+
+// TaskScheduler runs tasks on a fixed pool of worker threads, usually one per core.
+//
+// Every worker owns a TaskQueue. Tasks scheduled by a worker go to its own queue, all others are distributed
+// round-robin. A worker first works on its own queue and, once that is empty, steals tasks from the other queues.
+// Idle workers sleep until new tasks are scheduled.
+//
+// Operators use the scheduler through CurrentScheduler, e.g., by scheduling one JobTask per chunk.
+class TaskScheduler : private Noncopyable {
+ public:
+  explicit TaskScheduler(const uint32_t worker_count = std::thread::hardware_concurrency());
+
+  // finishes all tasks and stops the workers
+  ~TaskScheduler();
+
+  // adds a task to one of the queues
+  void schedule(const std::shared_ptr<AbstractTask>& task);
+
+  // blocks until all given tasks are done, then rethrows the exception of the first task that threw one, if any
+  // if called from a worker, e.g., by a task that waits for its subtasks, the worker keeps executing tasks while
+  // waiting, so that nested parallelism cannot block the whole pool
+  void wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  // executes the remaining tasks and stops the workers. No tasks may be scheduled afterwards.
+  void finish();
+
+  uint32_t worker_count() const;
+
+ protected:
+  // the main loop of a worker thread
+  void _work(const uint32_t worker_id);
+
+  // takes a task from the worker's own queue or steals one from another queue, returns nullptr if there is none
+  std::shared_ptr<AbstractTask> _next_task(const uint32_t worker_id);
+
+  // returns the id of the calling worker, or worker_count() if the calling thread is not a worker of this scheduler
+  uint32_t _current_worker_id() const;
+
+  std::vector<std::unique_ptr<TaskQueue>> _queues;
+  std::vector<std::thread> _workers;
+
+  // the number of tasks in all queues, used to let idle workers sleep
+  std::atomic<int64_t> _queued_tasks_count{0};
+  std::atomic<uint32_t> _next_queue_id{0};
+  std::atomic_bool _shutdown{false};
+
+  std::mutex _sleep_mutex;
+  std::condition_variable _sleep_condition_variable;
+};
+
+}  // namespace opossum
@@ -0,0 +1,147 @@
+#include "column_statistics.hpp"
+
+#include <optional>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "storage/for_each_value.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+namespace {
+
+// enough buckets to tell apart the frequent values of a chunk, while keeping estimates over many chunks cheap
+constexpr auto HISTOGRAM_BUCKET_COUNT = size_t{64};
+
+// NaN compares false to every value, which breaks the strict weak ordering that sorting and the histograms rely on
+template <typename T>
+bool is_nan(const T& value) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return std::isnan(value);
+  } else {
+    return false;
+  }
+}
+
+}  // namespace
+
+template <typename T>
+void ColumnStatistics<T>::add_column(const BaseColumn& column) {
+  std::vector<T> values;
+  values.reserve(column.size());
+  for_each_value_or_null<T>(column,
+                            [&](const T& value, const ChunkOffset) {
+                              if (is_nan(value)) {
+                                ++this->_nan_count;
+                                return;
+                              }
+                              values.push_back(value);
+                              this->_distinct_values.add(value);
+                            },
+                            [&](const ChunkOffset) { ++this->_null_count; });
+
+  std::sort(values.begin(), values.end());
+  if (!values.empty()) this->_histograms.emplace_back(values, HISTOGRAM_BUCKET_COUNT);
+  this->_row_count += column.size();
+}
+
+template <typename T>
+void ColumnStatistics<T>::merge(BaseColumnStatistics&& base_other) {
+  auto& other = static_cast<ColumnStatistics<T>&>(base_other);
+  this->_histograms.insert(this->_histograms.end(), std::make_move_iterator(other._histograms.begin()),
+                           std::make_move_iterator(other._histograms.end()));
+  this->_distinct_values.merge(other._distinct_values);
+  this->_row_count += other._row_count;
+  this->_null_count += other._null_count;
+  this->_nan_count += other._nan_count;
+}
+
+template <typename T>
+uint64_t ColumnStatistics<T>::row_count() const {
+  return this->_row_count;
+}
+
+template <typename T>
+double ColumnStatistics<T>::null_fraction() const {
+  if (this->_row_count == 0) return 0.0;
+  return static_cast<double>(this->_null_count) / static_cast<double>(this->_row_count);
+}
+
+template <typename T>
+double ColumnStatistics<T>::distinct_count() const {
+  // the sketch may overestimate small counts slightly, but there cannot be more distinct values than values
+  return std::min(this->_distinct_values.estimate(),
+                  static_cast<double>(this->_row_count - this->_null_count - this->_nan_count));
+}
+
+template <typename T>
+double ColumnStatistics<T>::estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value,
+                                                 const std::optional<AllTypeVariant>& search_value2) const {
+  // without statistics, every row is assumed to match
+  if (this->_row_count == 0) return 1.0;
+
+  const auto value = type_cast<T>(search_value);
+  // NaNs only satisfy !=, which they do for every search value, even NaN
+  const auto nan_count = static_cast<double>(this->_nan_count);
+  if (is_nan(value) || (search_value2 && is_nan(type_cast<T>(*search_value2)))) {
+    if (scan_type != ScanType::OpNotEquals) return 0.0;
+    return static_cast<double>(this->_row_count - this->_null_count) / static_cast<double>(this->_row_count);
+  }
+
+  const auto value_count = static_cast<double>(this->_row_count - this->_null_count - this->_nan_count);
+
+  auto estimate = 0.0;
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      estimate = this->_estimate_equals(value);
+      break;
+    case ScanType::OpNotEquals:
+      estimate = value_count - this->_estimate_equals(value) + nan_count;
+      break;
+    case ScanType::OpLessThan:
+      estimate = this->_estimate_less_than(value);
+      break;
+    case ScanType::OpLessThanEquals:
+      estimate = this->_estimate_less_than(value) + this->_estimate_equals(value);
+      break;
+    case ScanType::OpGreaterThan:
+      estimate = value_count - this->_estimate_less_than(value) - this->_estimate_equals(value);
+      break;
+    case ScanType::OpGreaterThanEquals:
+      estimate = value_count - this->_estimate_less_than(value);
+      break;
+    case ScanType::OpBetween: {
+      Assert(static_cast<bool>(search_value2), "OpBetween needs two search values");
+      const auto upper_value = type_cast<T>(*search_value2);
+      estimate = this->_estimate_less_than(upper_value) + this->_estimate_equals(upper_value) -
+                 this->_estimate_less_than(value);
+      break;
+    }
+  }
+
+  return std::clamp(estimate / static_cast<double>(this->_row_count), 0.0, 1.0);
+}
+
+template <typename T>
+double ColumnStatistics<T>::_estimate_less_than(const T& value) const {
+  auto estimate = 0.0;
+  for (const auto& histogram : this->_histograms) estimate += histogram.estimate_less_than(value);
+  return estimate;
+}
+
+template <typename T>
+double ColumnStatistics<T>::_estimate_equals(const T& value) const {
+  auto estimate = 0.0;
+  for (const auto& histogram : this->_histograms) estimate += histogram.estimate_equals(value);
+  return estimate;
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(ColumnStatistics);
+
+}  // namespace opossum
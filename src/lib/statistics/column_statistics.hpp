@@ -0,0 +1,72 @@
+#pragma once
+
+#include <optional>
+
+#include <cstdint>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "equi_depth_histogram.hpp"
+#include "hyperloglog.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+// BaseColumnStatistics is the non-templated base of the statistics of a single column, see ColumnStatistics.
+class BaseColumnStatistics {
+ public:
+  virtual ~BaseColumnStatistics() = default;
+
+  // adds the values of the column in a chunk that will not change anymore
+  virtual void add_column(const BaseColumn& column) = 0;
+
+  // adds the statistics of other chunks of the same column, e.g., those that a loader computed in parallel jobs
+  virtual void merge(BaseColumnStatistics&& other) = 0;
+
+  // returns the number of rows whose values were added, including NULLs
+  virtual uint64_t row_count() const = 0;
+
+  // returns the share of rows that are NULL, i.e., positions of a ReferenceColumn that are NULL_ROW_ID
+  virtual double null_fraction() const = 0;
+
+  // returns the estimated number of distinct values, not counting NULL and NaN
+  virtual double distinct_count() const = 0;
+
+  // returns the estimated share of rows whose value satisfies value <scan_type> search_value (or, for OpBetween,
+  // search_value <= value <= search_value2). NULLs never do.
+  virtual double estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value,
+                                      const std::optional<AllTypeVariant>& search_value2 = std::nullopt) const = 0;
+};
+
+// ColumnStatistics holds one equi-depth histogram per chunk that was added, and a HyperLogLog sketch for the distinct
+// values of all chunks. Adding a chunk costs one sort of its values, and estimates sum up the estimates of all
+// histograms, which are exact for chunks with fewer distinct values than buckets.
+template <typename T>
+class ColumnStatistics : public BaseColumnStatistics {
+ public:
+  void add_column(const BaseColumn& column) override;
+  void merge(BaseColumnStatistics&& other) override;
+
+  uint64_t row_count() const override;
+  double null_fraction() const override;
+  double distinct_count() const override;
+
+  double estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value,
+                              const std::optional<AllTypeVariant>& search_value2 = std::nullopt) const override;
+
+ protected:
+  // returns the estimated number of non-NULL values that are smaller than / equal to the given value
+  double _estimate_less_than(const T& value) const;
+  double _estimate_equals(const T& value) const;
+
+  std::vector<EquiDepthHistogram<T>> _histograms;
+  HyperLogLog _distinct_values;
+  uint64_t _row_count = 0;
+  uint64_t _null_count = 0;
+  // NaNs are neither part of the histograms nor of the distinct values
+  uint64_t _nan_count = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,81 @@
+#include "equi_depth_histogram.hpp"
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+EquiDepthHistogram<T>::EquiDepthHistogram(const std::vector<T>& sorted_values, const size_t max_bucket_count)
+    : _total_count(sorted_values.size()) {
+  Assert(max_bucket_count > 0, "Histograms need at least one bucket");
+  DebugAssert(std::is_sorted(sorted_values.cbegin(), sorted_values.cend()), "Values need to be sorted");
+
+  const auto size = sorted_values.size();
+  const auto depth = std::max(size_t{1}, (size + max_bucket_count - 1) / max_bucket_count);
+
+  auto begin = size_t{0};
+  while (begin < size) {
+    // the bucket is extended to the last occurrence of its largest value
+    auto end = std::min(size, begin + depth);
+    while (end < size && sorted_values[end] == sorted_values[end - 1]) ++end;
+
+    auto distinct_count = uint64_t{1};
+    for (auto index = begin + 1; index < end; ++index) {
+      if (sorted_values[index] != sorted_values[index - 1]) ++distinct_count;
+    }
+
+    this->_buckets.push_back(Bucket{sorted_values[begin], sorted_values[end - 1], end - begin, distinct_count});
+    begin = end;
+  }
+}
+
+template <typename T>
+const std::vector<typename EquiDepthHistogram<T>::Bucket>& EquiDepthHistogram<T>::buckets() const {
+  return this->_buckets;
+}
+
+template <typename T>
+uint64_t EquiDepthHistogram<T>::total_count() const {
+  return this->_total_count;
+}
+
+template <typename T>
+double EquiDepthHistogram<T>::estimate_less_than(const T& value) const {
+  auto estimate = 0.0;
+  for (const auto& bucket : this->_buckets) {
+    if (bucket.max < value) {
+      estimate += static_cast<double>(bucket.count);
+    } else if (bucket.min < value) {
+      // the value lies within the bucket, whose values are less than the value in proportion to its distance to min
+      if constexpr (std::is_arithmetic_v<T>) {
+        const auto share = (static_cast<double>(value) - static_cast<double>(bucket.min)) /
+                           (static_cast<double>(bucket.max) - static_cast<double>(bucket.min));
+        estimate += share * static_cast<double>(bucket.count);
+      } else {
+        estimate += 0.5 * static_cast<double>(bucket.count);
+      }
+      break;
+    } else {
+      break;
+    }
+  }
+  return estimate;
+}
+
+template <typename T>
+double EquiDepthHistogram<T>::estimate_equals(const T& value) const {
+  const auto bucket = std::lower_bound(this->_buckets.cbegin(), this->_buckets.cend(), value,
+                                       [](const Bucket& bucket, const T& value) { return bucket.max < value; });
+  if (bucket == this->_buckets.cend() || value < bucket->min) return 0.0;
+  return static_cast<double>(bucket->count) / static_cast<double>(bucket->distinct_count);
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(EquiDepthHistogram);
+
+}  // namespace opossum
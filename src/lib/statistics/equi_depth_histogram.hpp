@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace opossum {
+
+// An equi-depth histogram splits the sorted values of a column into buckets that hold about the same number of values.
+// Each bucket knows its smallest and largest value, its number of values, and its number of distinct values.
+// All occurrences of a value are in the same bucket, so that frequent values get buckets of their own.
+// Within a bucket, values are assumed to be spread uniformly between its bounds (for strings, a predicate within the
+// bounds is estimated to hit half of the bucket), and all distinct values to occur equally often.
+template <typename T>
+class EquiDepthHistogram {
+ public:
+  struct Bucket {
+    T min;
+    T max;
+    uint64_t count;
+    uint64_t distinct_count;
+  };
+
+  // builds the histogram from the sorted values
+  EquiDepthHistogram(const std::vector<T>& sorted_values, const size_t max_bucket_count);
+
+  const std::vector<Bucket>& buckets() const;
+
+  // returns the number of values the histogram was built from
+  uint64_t total_count() const;
+
+  // returns the estimated number of values that are smaller than the given value
+  double estimate_less_than(const T& value) const;
+
+  // returns the estimated number of values that are equal to the given value
+  double estimate_equals(const T& value) const;
+
+ protected:
+  std::vector<Bucket> _buckets;
+  uint64_t _total_count = 0;
+};
+
+}  // namespace opossum
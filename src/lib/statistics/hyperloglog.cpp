@@ -0,0 +1,55 @@
+#include "hyperloglog.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+HyperLogLog::HyperLogLog(const uint8_t precision) : _precision(precision), _registers(size_t{1} << precision, 0) {
+  Assert(precision >= 4 && precision <= 18, "HyperLogLog precision needs to be between 4 and 18");
+}
+
+void HyperLogLog::add_hash(const uint64_t hash) {
+  const auto register_index = hash >> (64 - this->_precision);
+  const auto remaining_bits = hash << this->_precision;
+
+  // the rank of a hash whose remaining bits are all zero is the largest possible one
+  const auto max_rank = static_cast<uint8_t>(64 - this->_precision + 1);
+  const auto rank =
+      remaining_bits == 0 ? max_rank : std::min(max_rank, static_cast<uint8_t>(__builtin_clzll(remaining_bits) + 1));
+
+  auto& register_value = this->_registers[register_index];
+  register_value = std::max(register_value, rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  Assert(this->_precision == other._precision, "Only sketches of the same precision can be merged");
+  for (size_t index = 0; index < this->_registers.size(); ++index) {
+    this->_registers[index] = std::max(this->_registers[index], other._registers[index]);
+  }
+}
+
+double HyperLogLog::estimate() const {
+  const auto register_count = static_cast<double>(this->_registers.size());
+
+  auto harmonic_sum = 0.0;
+  auto zero_registers = size_t{0};
+  for (const auto register_value : this->_registers) {
+    harmonic_sum += std::ldexp(1.0, -register_value);
+    if (register_value == 0) ++zero_registers;
+  }
+
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto estimate = alpha * register_count * register_count / harmonic_sum;
+
+  // for small cardinalities, where many registers are still empty, linear counting is more accurate
+  if (estimate <= 2.5 * register_count && zero_registers > 0) {
+    return register_count * std::log(register_count / static_cast<double>(zero_registers));
+  }
+  return estimate;
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "utils/mixed_hash.hpp"
+
+namespace opossum {
+
+// HyperLogLog estimates the number of distinct values of a multiset in constant space. The hash of each value selects
+// one of 2^precision registers, which keeps the highest rank (number of leading zeros plus one) of all hashes that
+// selected it. The standard error of the estimate is about 1.04 / sqrt(2^precision), i.e., 1.6% for the default
+// precision, which needs 4 KB.
+// Sketches of the same precision can be merged, e.g., to combine the sketches of several chunks.
+class HyperLogLog {
+ public:
+  explicit HyperLogLog(const uint8_t precision = 12);
+
+  // adds a value, given by its hash, whose bits need to be well distributed
+  void add_hash(const uint64_t hash);
+
+  template <typename T>
+  void add(const T& value) {
+    this->add_hash(mixed_hash(value));
+  }
+
+  // adds all values of the other sketch
+  void merge(const HyperLogLog& other);
+
+  double estimate() const;
+
+ protected:
+  const uint8_t _precision;
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#include "table_statistics.hpp"
+
+#include <optional>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void TableStatistics::add_chunk(const Chunk& chunk, const std::vector<std::string>& column_types) {
+  DebugAssert(chunk.col_count() == column_types.size(), "Need one type per column");
+
+  // columns that were added to the table after its first chunk start with that chunk
+  while (this->_column_statistics.size() < column_types.size()) {
+    this->_column_statistics.emplace_back(make_shared_by_column_type<BaseColumnStatistics, ColumnStatistics>(
+        column_types[this->_column_statistics.size()]));
+  }
+
+  if (chunk.size() == 0) return;
+
+  // This does not schedule jobs, as chunks are sealed while appending, which may happen within a job itself, e.g.,
+  // under the lock of Table::append_concurrently().
+  for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+    this->_column_statistics[column_id]->add_column(*chunk.get_column(column_id));
+  }
+
+  this->_row_count += chunk.size();
+}
+
+void TableStatistics::merge(TableStatistics&& other) {
+  for (ColumnID column_id{0}; column_id < other._column_statistics.size(); ++column_id) {
+    if (column_id < this->_column_statistics.size()) {
+      this->_column_statistics[column_id]->merge(std::move(*other._column_statistics[column_id]));
+    } else {
+      this->_column_statistics.push_back(std::move(other._column_statistics[column_id]));
+    }
+  }
+  this->_row_count += other._row_count;
+}
+
+uint64_t TableStatistics::row_count() const { return this->_row_count; }
+
+const BaseColumnStatistics& TableStatistics::column_statistics(const ColumnID column_id) const {
+  DebugAssert(static_cast<size_t>(column_id) < this->_column_statistics.size(), "No statistics for this column");
+  return *this->_column_statistics[column_id];
+}
+
+double TableStatistics::estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                                             const AllTypeVariant& search_value,
+                                             const std::optional<AllTypeVariant>& search_value2) const {
+  if (static_cast<size_t>(column_id) >= this->_column_statistics.size()) return 1.0;
+  return this->_column_statistics[column_id]->estimate_selectivity(scan_type, search_value, search_value2);
+}
+
+double TableStatistics::estimate_cardinality(const ColumnID column_id, const ScanType scan_type,
+                                             const AllTypeVariant& search_value,
+                                             const std::optional<AllTypeVariant>& search_value2) const {
+  return this->estimate_selectivity(column_id, scan_type, search_value, search_value2) *
+         static_cast<double>(this->_row_count);
+}
+
+double TableStatistics::estimate_join_cardinality(const ColumnID column_id, const TableStatistics& right_statistics,
+                                                  const ColumnID right_column_id) const {
+  const auto& left_column_statistics = this->column_statistics(column_id);
+  const auto& right_column_statistics = right_statistics.column_statistics(right_column_id);
+
+  const auto left_rows = static_cast<double>(this->_row_count) * (1.0 - left_column_statistics.null_fraction());
+  const auto right_rows =
+      static_cast<double>(right_statistics._row_count) * (1.0 - right_column_statistics.null_fraction());
+  const auto distinct_count =
+      std::max(left_column_statistics.distinct_count(), right_column_statistics.distinct_count());
+
+  if (distinct_count < 1.0) return 0.0;
+  return left_rows * right_rows / distinct_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <optional>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "column_statistics.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// TableStatistics holds the statistics of all columns of a table, which are used to estimate the cardinality of
+// operator results, e.g., to order joins and to choose their build side.
+// The table adds each chunk once it is sealed, i.e., once it does not receive further rows (see Table). The rows of
+// the chunk that is still being filled are not part of the statistics.
+class TableStatistics {
+ public:
+  // adds the values of a sealed chunk, whose columns have the given types
+  void add_chunk(const Chunk& chunk, const std::vector<std::string>& column_types);
+
+  // adds the statistics of other chunks of the same columns, e.g., those that a loader computed in parallel jobs
+  void merge(TableStatistics&& other);
+
+  // returns the number of rows that the statistics cover
+  uint64_t row_count() const;
+
+  const BaseColumnStatistics& column_statistics(const ColumnID column_id) const;
+
+  // returns the estimated share of rows that satisfy the predicate on the given column, see BaseColumnStatistics
+  double estimate_selectivity(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value,
+                              const std::optional<AllTypeVariant>& search_value2 = std::nullopt) const;
+
+  // returns the estimated number of rows that satisfy the predicate on the given column
+  double estimate_cardinality(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value,
+                              const std::optional<AllTypeVariant>& search_value2 = std::nullopt) const;
+
+  // Returns the estimated number of rows of an inner equi-join of this table with the right one. It assumes that all
+  // distinct values of the column with fewer of them also occur in the other column, i.e., the result has
+  // left_rows * right_rows / max(left_distinct_count, right_distinct_count) rows.
+  double estimate_join_cardinality(const ColumnID column_id, const TableStatistics& right_statistics,
+                                   const ColumnID right_column_id) const;
+
+ protected:
+  uint64_t _row_count = 0;
+  std::vector<std::shared_ptr<BaseColumnStatistics>> _column_statistics;
+};
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// BaseAttributeVector is the abstract super class for all attribute vectors,
+// e.g., FixedSizeAttributeVector and BitPackedAttributeVector
+//
+// An attribute vector maps the rows of an encoded column to the ValueIDs of their values. Implementations are final
+// and define get() in their header, so that code knowing the concrete type (see resolve_attribute_vector in
+// fitted_attribute_vector.hpp) gets inlined, branch-free accesses instead of one virtual call per row.
+class BaseAttributeVector : private Noncopyable {
+ public:
+  BaseAttributeVector() = default;
+  virtual ~BaseAttributeVector() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BaseAttributeVector(BaseAttributeVector&&) = default;
+  BaseAttributeVector& operator=(BaseAttributeVector&&) = default;
+
+  // returns the value id at a given position
+  virtual ValueID get(const size_t i) const = 0;
+
+  // sets the value id at a given position
+  virtual void set(const size_t i, const ValueID value_id) = 0;
+
+  // returns the number of values
+  virtual size_t size() const = 0;
+
+  // returns the number of bits used to store a single value id
+  virtual AttributeVectorWidth width() const = 0;
+};
+}  // namespace opossum
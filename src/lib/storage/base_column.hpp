@@ -28,5 +28,12 @@ class BaseColumn : private Noncopyable {
 
   // returns the number of values
   virtual size_t size() const = 0;
+
+  // preallocates memory for the given number of values so that appending them does not reallocate
+  // immutable columns ignore this
+  virtual void reserve(const size_t /*capacity*/) {}
+
+  // releases memory that was reserved but is not used by any value
+  virtual void shrink_to_fit() {}
 };
 }  // namespace opossum
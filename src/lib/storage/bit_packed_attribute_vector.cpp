@@ -0,0 +1,47 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const AttributeVectorWidth width)
+    : _words((size * width + 63) / 64 + 1), _size(size), _width(width), _mask((uint64_t{1} << width) - 1) {
+  Assert(width > 0 && width <= 32, "BitPackedAttributeVector supports widths from 1 to 32 bits");
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const AttributeVectorWidth width,
+                                                   std::vector<uint64_t>&& words)
+    : _words(std::move(words)), _size(size), _width(width), _mask((uint64_t{1} << width) - 1) {
+  Assert(width > 0 && width <= 32, "BitPackedAttributeVector supports widths from 1 to 32 bits");
+  Assert(this->_words.size() == (size * width + 63) / 64 + 1, "Number of words does not match the size");
+}
+
+void BitPackedAttributeVector::set(const size_t i, const ValueID value_id) {
+  DebugAssert(i < this->_size, "Index out of range");
+  DebugAssert((value_id & ~this->_mask) == 0, "ValueID does not fit into the attribute vector");
+
+  const auto bit_offset = i * this->_width;
+  const auto word_index = bit_offset / 64;
+  const auto shift = bit_offset % 64;
+  const auto value = static_cast<uint64_t>(value_id);
+
+  auto& lower = this->_words[word_index];
+  lower = (lower & ~(this->_mask << shift)) | (value << shift);
+
+  // the bits that spill over into the next word, if any (see get())
+  auto& upper = this->_words[word_index + 1];
+  const auto upper_mask = (this->_mask >> 1) >> (63 - shift);
+  upper = (upper & ~upper_mask) | ((value >> 1) >> (63 - shift));
+}
+
+size_t BitPackedAttributeVector::size() const { return this->_size; }
+
+AttributeVectorWidth BitPackedAttributeVector::width() const { return this->_width; }
+
+const std::vector<uint64_t>& BitPackedAttributeVector::words() const { return this->_words; }
+
+}  // namespace opossum
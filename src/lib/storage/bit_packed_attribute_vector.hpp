@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+
+namespace opossum {
+
+// BitPackedAttributeVector stores each value id in exactly width() bits (1 to 32), packed into 64-bit words.
+// A value may span two adjacent words. Instead of branching on that case, get() always reads both words and
+// shifts the upper one out of the way if it is not needed. The last word is followed by a padding word, so
+// that this read never goes out of bounds.
+class BitPackedAttributeVector final : public BaseAttributeVector {
+ public:
+  BitPackedAttributeVector(const size_t size, const AttributeVectorWidth width);
+
+  // creates an attribute vector from the words of another one, e.g., when loading it
+  BitPackedAttributeVector(const size_t size, const AttributeVectorWidth width, std::vector<uint64_t>&& words);
+
+  ValueID get(const size_t i) const final {
+    const auto bit_offset = i * this->_width;
+    const auto word_index = bit_offset / 64;
+    const auto shift = bit_offset % 64;
+
+    // (x << 1) << (63 - shift) equals x << (64 - shift), but stays defined for shift == 0
+    const auto lower = this->_words[word_index] >> shift;
+    const auto upper = (this->_words[word_index + 1] << 1) << (63 - shift);
+    return ValueID{static_cast<ValueID::base_type>((lower | upper) & this->_mask)};
+  }
+
+  void set(const size_t i, const ValueID value_id) final;
+
+  size_t size() const final;
+
+  AttributeVectorWidth width() const final;
+
+  // returns the packed value ids, including the padding word
+  const std::vector<uint64_t>& words() const;
+
+ protected:
+  std::vector<uint64_t> _words;
+  size_t _size;
+  AttributeVectorWidth _width;
+  uint64_t _mask;
+};
+
+}  // namespace opossum
@@ -9,6 +9,7 @@
 
 #include "base_column.hpp"
 #include "chunk.hpp"
+#include "index/base_index.hpp"
 
 #include "utils/assert.hpp"
 
@@ -23,7 +24,19 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
 
   // push back in all columns
   for (std::size_t i = 0; i < values.size(); i++) {
-    this->get_column(ColumnID{i})->append(values.at(i));
+    this->_columns[i]->append(values[i]);
+  }
+}
+
+void Chunk::reserve(const size_t capacity) {
+  for (auto& column : this->_columns) {
+    column->reserve(capacity);
+  }
+}
+
+void Chunk::shrink_to_fit() {
+  for (auto& column : this->_columns) {
+    column->shrink_to_fit();
   }
 }
 
@@ -31,6 +44,39 @@ std::shared_ptr<BaseColumn> Chunk::get_column(ColumnID column_id) const {
   return this->_columns.at(column_id);
 }
 
+void Chunk::mark_as_sealed() { this->_is_sealed = true; }
+
+bool Chunk::is_sealed() const { return this->_is_sealed; }
+
+void Chunk::set_zone_maps(std::vector<std::optional<ZoneMap>> zone_maps) {
+  DebugAssert(zone_maps.empty() || zone_maps.size() == this->_columns.size(), "Need one zone map per column");
+  this->_zone_maps = std::move(zone_maps);
+}
+
+const std::optional<ZoneMap>& Chunk::zone_map(ColumnID column_id) const {
+  static const std::optional<ZoneMap> no_zone_map;
+  if (this->_zone_maps.empty()) return no_zone_map;
+  return this->_zone_maps[column_id];
+}
+
+std::vector<std::shared_ptr<const BaseIndex>> Chunk::get_indices_for(const std::vector<ColumnID>& column_ids) const {
+  const auto columns = this->_get_columns(column_ids);
+
+  std::vector<std::shared_ptr<const BaseIndex>> indices;
+  for (const auto& index : this->_indices) {
+    if (index->is_index_for(columns)) indices.push_back(index);
+  }
+  return indices;
+}
+
+const std::vector<std::shared_ptr<const BaseIndex>>& Chunk::indices() const { return this->_indices; }
+
+std::vector<std::shared_ptr<const BaseColumn>> Chunk::_get_columns(const std::vector<ColumnID>& column_ids) const {
+  std::vector<std::shared_ptr<const BaseColumn>> columns;
+  for (const auto& column_id : column_ids) columns.push_back(this->_columns.at(column_id));
+  return columns;
+}
+
 uint16_t Chunk::col_count() const {
   return static_cast<uint16_t>(this->_columns.size());
 }
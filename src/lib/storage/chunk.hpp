@@ -1,6 +1,7 @@
 #pragma once
 
 // the linter wants this to be above everything else
+#include <optional>
 #include <shared_mutex>
 
 #include <atomic>
@@ -10,6 +11,7 @@
 
 #include "all_type_variant.hpp"
 #include "types.hpp"
+#include "zone_map.hpp"
 
 namespace opossum {
 
@@ -42,12 +44,52 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  // preallocates all columns for the given number of rows
+  void reserve(const size_t capacity);
+
+  // releases memory that the columns reserved but do not use, e.g., once the chunk will not grow anymore
+  void shrink_to_fit();
+
   // Returns the column at a given position
   std::shared_ptr<BaseColumn> get_column(ColumnID column_id) const;
 
+  // marks the chunk as sealed, i.e., it will not receive further rows, and its rows are part of the statistics of
+  // its table. Only the table seals its chunks.
+  void mark_as_sealed();
+
+  bool is_sealed() const;
+
+  // sets the zone maps of all columns, see create_zone_maps()
+  // the table does this when the chunk is sealed
+  void set_zone_maps(std::vector<std::optional<ZoneMap>> zone_maps);
+
+  // returns the zone map of a column, or nothing if the column has none, e.g., because the chunk is not sealed
+  const std::optional<ZoneMap>& zone_map(ColumnID column_id) const;
+
+  // creates an index of the given type (e.g., GroupKeyIndex, see storage/index/) over the given columns
+  // the index refers to the current columns, so it should only be created once the chunk will not change anymore
+  template <typename Index>
+  std::shared_ptr<Index> create_index(const std::vector<ColumnID>& column_ids) {
+    auto index = std::make_shared<Index>(this->_get_columns(column_ids));
+    this->_indices.push_back(index);
+    return index;
+  }
+
+  // returns all indexes that can be used for lookups on the given columns, see BaseIndex::is_index_for()
+  std::vector<std::shared_ptr<const BaseIndex>> get_indices_for(const std::vector<ColumnID>& column_ids) const;
+
+  // returns all indexes of the chunk
+  const std::vector<std::shared_ptr<const BaseIndex>>& indices() const;
+
  protected:
   // Implementation goes here
   std::vector<std::shared_ptr<BaseColumn>> _columns;
+  // either empty or one per column
+  std::vector<std::optional<ZoneMap>> _zone_maps;
+  bool _is_sealed = false;
+  std::vector<std::shared_ptr<const BaseIndex>> _indices;
+
+  std::vector<std::shared_ptr<const BaseColumn>> _get_columns(const std::vector<ColumnID>& column_ids) const;
 };
 
 }  // namespace opossum
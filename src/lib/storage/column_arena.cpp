@@ -0,0 +1,27 @@
+#include "column_arena.hpp"
+
+#include <memory_resource>
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace opossum {
+
+ColumnArena::ColumnArena(const size_t initial_block_size, std::shared_ptr<std::pmr::memory_resource> upstream)
+    : _upstream(std::move(upstream)),
+      _monotonic_resource(initial_block_size,
+                          this->_upstream ? this->_upstream.get() : std::pmr::new_delete_resource()) {}
+
+void* ColumnArena::do_allocate(size_t bytes, size_t alignment) {
+  std::lock_guard<std::mutex> lock(this->_mutex);
+  return this->_monotonic_resource.allocate(bytes, alignment);
+}
+
+void ColumnArena::do_deallocate(void*, size_t, size_t) {
+  // the memory is freed with the arena
+}
+
+bool ColumnArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept { return this == &other; }
+
+}  // namespace opossum
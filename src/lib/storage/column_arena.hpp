@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory_resource>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// ColumnArena is a monotonic memory resource for the values of ValueColumns. Allocating bumps a pointer within the
+// current block, deallocating does nothing, and all blocks are freed at once when the arena is destroyed, i.e., once
+// the last column that allocated from it is gone (columns keep their arena alive). A table or chunk with an arena of
+// its own thus frees all of its values in one go when it is dropped, and the threads of a parallel load that each
+// fill their own arena do not contend for the global allocator.
+// Memory that a vector leaves behind when it grows is not reused, so columns should reserve their final size first.
+// Arenas are thread-safe, but threads that share one serialize their allocations.
+class ColumnArena : public std::pmr::memory_resource, private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_INITIAL_BLOCK_SIZE = size_t{1} << 20;
+
+  // the blocks come from upstream, e.g., a NumaMemoryResource, which the arena keeps alive, or from new and delete
+  explicit ColumnArena(const size_t initial_block_size = DEFAULT_INITIAL_BLOCK_SIZE,
+                       std::shared_ptr<std::pmr::memory_resource> upstream = nullptr);
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  // declared before the monotonic resource so that it outlives it
+  const std::shared_ptr<std::pmr::memory_resource> _upstream;
+  std::mutex _mutex;
+  std::pmr::monotonic_buffer_resource _monotonic_resource;
+};
+
+}  // namespace opossum
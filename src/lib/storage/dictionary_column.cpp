@@ -0,0 +1,117 @@
+#include "dictionary_column.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fitted_attribute_vector.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+DictionaryColumn<T>::DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column)
+    : _dictionary(std::make_shared<std::vector<T>>()) {
+  const auto value_column = std::dynamic_pointer_cast<ValueColumn<T>>(base_column);
+  Assert(value_column != nullptr, "DictionaryColumn can only be created from a ValueColumn of the same type");
+
+  // the values are read through data(), which also works for columns that do not own them
+  const auto values = value_column->data();
+  const auto size = value_column->size();
+
+  this->_dictionary->assign(values, values + size);
+  std::sort(this->_dictionary->begin(), this->_dictionary->end());
+  this->_dictionary->erase(std::unique(this->_dictionary->begin(), this->_dictionary->end()), this->_dictionary->end());
+  this->_dictionary->shrink_to_fit();
+
+  this->_attribute_vector = make_fitted_attribute_vector(this->_dictionary->size(), size);
+  for (size_t chunk_offset = 0; chunk_offset < size; ++chunk_offset) {
+    const auto it = std::lower_bound(this->_dictionary->cbegin(), this->_dictionary->cend(), values[chunk_offset]);
+    const auto value_id = std::distance(this->_dictionary->cbegin(), it);
+    this->_attribute_vector->set(chunk_offset, ValueID{static_cast<ValueID::base_type>(value_id)});
+  }
+}
+
+template <typename T>
+DictionaryColumn<T>::DictionaryColumn(std::shared_ptr<std::vector<T>> dictionary,
+                                      std::shared_ptr<BaseAttributeVector> attribute_vector)
+    : _dictionary(std::move(dictionary)), _attribute_vector(std::move(attribute_vector)) {
+  DebugAssert(std::is_sorted(this->_dictionary->cbegin(), this->_dictionary->cend()), "Dictionary must be sorted");
+}
+
+template <typename T>
+const AllTypeVariant DictionaryColumn<T>::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+
+  return this->get(i);
+}
+
+template <typename T>
+const T DictionaryColumn<T>::get(const size_t i) const {
+  return (*this->_dictionary)[this->_attribute_vector->get(i)];
+}
+
+template <typename T>
+void DictionaryColumn<T>::append(const AllTypeVariant&) {
+  Fail("DictionaryColumn is immutable");
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> DictionaryColumn<T>::dictionary() const {
+  return this->_dictionary;
+}
+
+template <typename T>
+std::shared_ptr<const BaseAttributeVector> DictionaryColumn<T>::attribute_vector() const {
+  return this->_attribute_vector;
+}
+
+template <typename T>
+const T& DictionaryColumn<T>::value_by_value_id(ValueID value_id) const {
+  return this->_dictionary->at(value_id);
+}
+
+template <typename T>
+ValueID DictionaryColumn<T>::lower_bound(const T value) const {
+  const auto it = std::lower_bound(this->_dictionary->cbegin(), this->_dictionary->cend(), value);
+  if (it == this->_dictionary->cend()) return INVALID_VALUE_ID;
+
+  return ValueID{static_cast<ValueID::base_type>(std::distance(this->_dictionary->cbegin(), it))};
+}
+
+template <typename T>
+ValueID DictionaryColumn<T>::lower_bound(const AllTypeVariant& value) const {
+  return this->lower_bound(type_cast<T>(value));
+}
+
+template <typename T>
+ValueID DictionaryColumn<T>::upper_bound(const T value) const {
+  const auto it = std::upper_bound(this->_dictionary->cbegin(), this->_dictionary->cend(), value);
+  if (it == this->_dictionary->cend()) return INVALID_VALUE_ID;
+
+  return ValueID{static_cast<ValueID::base_type>(std::distance(this->_dictionary->cbegin(), it))};
+}
+
+template <typename T>
+ValueID DictionaryColumn<T>::upper_bound(const AllTypeVariant& value) const {
+  return this->upper_bound(type_cast<T>(value));
+}
+
+template <typename T>
+size_t DictionaryColumn<T>::unique_values_count() const {
+  return this->_dictionary->size();
+}
+
+template <typename T>
+size_t DictionaryColumn<T>::size() const {
+  return this->_attribute_vector->size();
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(DictionaryColumn);
+
+}  // namespace opossum
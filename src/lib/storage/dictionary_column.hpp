@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "base_column.hpp"
+
+namespace opossum {
+
+// DictionaryColumn is an immutable column type that stores each distinct value once in a sorted dictionary.
+// The rows themselves are represented by an attribute vector holding the ValueID (i.e., the dictionary
+// position) of their value. Because the dictionary is sorted, ValueIDs compare like the values they stand for.
+// The attribute vector uses the narrowest width that fits the number of distinct values.
+template <typename T>
+class DictionaryColumn : public BaseColumn {
+ public:
+  // creates a dictionary column from the given value column
+  explicit DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column);
+
+  // creates a dictionary column from its parts, e.g., when loading it
+  // the dictionary must be sorted and free of duplicates, and the attribute vector must refer to it
+  DictionaryColumn(std::shared_ptr<std::vector<T>> dictionary, std::shared_ptr<BaseAttributeVector> attribute_vector);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // return the value at a certain position
+  const T get(const size_t i) const;
+
+  // dictionary columns are immutable
+  void append(const AllTypeVariant&) override;
+
+  // returns an underlying dictionary
+  std::shared_ptr<const std::vector<T>> dictionary() const;
+
+  // returns an underlying data structure
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const;
+
+  // return the value represented by a given ValueID
+  const T& value_by_value_id(ValueID value_id) const;
+
+  // returns the first value ID that refers to a value >= the search value
+  // returns INVALID_VALUE_ID if all values are smaller than the search value
+  ValueID lower_bound(const T value) const;
+
+  // same as lower_bound(T), but accepts an AllTypeVariant
+  ValueID lower_bound(const AllTypeVariant& value) const;
+
+  // returns the first value ID that refers to a value > the search value
+  // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
+  ValueID upper_bound(const T value) const;
+
+  // same as upper_bound(T), but accepts an AllTypeVariant
+  ValueID upper_bound(const AllTypeVariant& value) const;
+
+  // return the number of unique_values (dictionary entries)
+  size_t unique_values_count() const;
+
+  // return the number of entries
+  size_t size() const override;
+
+ protected:
+  std::shared_ptr<std::vector<T>> _dictionary;
+  std::shared_ptr<BaseAttributeVector> _attribute_vector;
+};
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#include "fitted_attribute_vector.hpp"
+
+#include <cstdint>
+#include <memory>
+
+namespace opossum {
+
+AttributeVectorWidth attribute_vector_width_for(const size_t unique_values_count) {
+  AttributeVectorWidth width = 1;
+  while (width < 32 && (uint64_t{1} << width) < unique_values_count) {
+    ++width;
+  }
+  return width;
+}
+
+std::shared_ptr<BaseAttributeVector> make_fitted_attribute_vector(const size_t unique_values_count, const size_t size) {
+  const auto width = attribute_vector_width_for(unique_values_count);
+
+  switch (width) {
+    case 8:
+      return std::make_shared<FixedSizeAttributeVector<uint8_t>>(size);
+    case 16:
+      return std::make_shared<FixedSizeAttributeVector<uint16_t>>(size);
+    case 32:
+      return std::make_shared<FixedSizeAttributeVector<uint32_t>>(size);
+    default:
+      return std::make_shared<BitPackedAttributeVector>(size, width);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "base_attribute_vector.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "fixed_size_attribute_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// returns the number of bits needed to store the value ids 0 to unique_values_count - 1 (at least one)
+AttributeVectorWidth attribute_vector_width_for(const size_t unique_values_count);
+
+// creates the narrowest attribute vector that can hold value ids for the given number of distinct values.
+// Byte-aligned widths (8, 16, and 32 bits) use a FixedSizeAttributeVector, all others a BitPackedAttributeVector.
+std::shared_ptr<BaseAttributeVector> make_fitted_attribute_vector(const size_t unique_values_count, const size_t size);
+
+/**
+ * Resolves the concrete type of an attribute vector and passes it on to a generic lambda. Because all attribute
+ * vectors are final, calls to get() within the lambda are neither virtual nor branching.
+ *
+ * Example:
+ *
+ *   resolve_attribute_vector(*dictionary_column.attribute_vector(), [&](const auto& attribute_vector) {
+ *     for (size_t chunk_offset = 0; chunk_offset < attribute_vector.size(); ++chunk_offset) {
+ *       if (attribute_vector.get(chunk_offset) == search_value_id) ...
+ *     }
+ *   });
+ */
+template <typename Functor>
+void resolve_attribute_vector(const BaseAttributeVector& attribute_vector, const Functor& func) {
+  if (const auto fixed_8 = dynamic_cast<const FixedSizeAttributeVector<uint8_t>*>(&attribute_vector)) {
+    func(*fixed_8);
+  } else if (const auto fixed_16 = dynamic_cast<const FixedSizeAttributeVector<uint16_t>*>(&attribute_vector)) {
+    func(*fixed_16);
+  } else if (const auto fixed_32 = dynamic_cast<const FixedSizeAttributeVector<uint32_t>*>(&attribute_vector)) {
+    func(*fixed_32);
+  } else if (const auto bit_packed = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    func(*bit_packed);
+  } else {
+    Fail("Unknown attribute vector type");
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#include "fixed_size_attribute_vector.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename uintX_t>
+FixedSizeAttributeVector<uintX_t>::FixedSizeAttributeVector(const size_t size) : _attribute_vector(size) {}
+
+template <typename uintX_t>
+FixedSizeAttributeVector<uintX_t>::FixedSizeAttributeVector(std::vector<uintX_t>&& values)
+    : _attribute_vector(std::move(values)) {}
+
+template <typename uintX_t>
+void FixedSizeAttributeVector<uintX_t>::set(const size_t i, const ValueID value_id) {
+  DebugAssert(static_cast<ValueID::base_type>(value_id) <= std::numeric_limits<uintX_t>::max(),
+              "ValueID does not fit into the attribute vector");
+  this->_attribute_vector[i] = static_cast<uintX_t>(value_id);
+}
+
+template <typename uintX_t>
+size_t FixedSizeAttributeVector<uintX_t>::size() const {
+  return this->_attribute_vector.size();
+}
+
+template <typename uintX_t>
+AttributeVectorWidth FixedSizeAttributeVector<uintX_t>::width() const {
+  return sizeof(uintX_t) * 8;
+}
+
+template <typename uintX_t>
+const std::vector<uintX_t>& FixedSizeAttributeVector<uintX_t>::values() const {
+  return this->_attribute_vector;
+}
+
+template class FixedSizeAttributeVector<uint8_t>;
+template class FixedSizeAttributeVector<uint16_t>;
+template class FixedSizeAttributeVector<uint32_t>;
+
+}  // namespace opossum
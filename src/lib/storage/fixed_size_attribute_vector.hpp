@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+
+namespace opossum {
+
+// FixedSizeAttributeVector stores each value id in an unsigned integer of the given width (uint8_t, uint16_t or
+// uint32_t). Accesses are plain array lookups.
+template <typename uintX_t>
+class FixedSizeAttributeVector final : public BaseAttributeVector {
+ public:
+  explicit FixedSizeAttributeVector(const size_t size);
+
+  // creates an attribute vector from the given value ids, e.g., when loading it
+  explicit FixedSizeAttributeVector(std::vector<uintX_t>&& values);
+
+  ValueID get(const size_t i) const final { return ValueID{this->_attribute_vector[i]}; }
+
+  void set(const size_t i, const ValueID value_id) final;
+
+  size_t size() const final;
+
+  AttributeVectorWidth width() const final;
+
+  // returns the underlying values, e.g., for operators that scan the value ids directly
+  const std::vector<uintX_t>& values() const;
+
+ protected:
+  std::vector<uintX_t> _attribute_vector;
+};
+
+}  // namespace opossum
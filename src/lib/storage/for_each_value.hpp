@@ -0,0 +1,91 @@
+#pragma once
+
+#include "base_column.hpp"
+#include "dictionary_column.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "reference_column.hpp"
+#include "table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+/**
+ * Calls func(value, chunk_offset) for every value of a column of type T, in the order of the column. This works for
+ * ValueColumns, DictionaryColumns, and ReferenceColumns to either of them, without constructing AllTypeVariants.
+ * Positions of a ReferenceColumn that are NULL_ROW_ID (e.g., in the result of an outer join) do not have a value
+ * and are skipped.
+ *
+ * Example:
+ *
+ *   auto sum = int64_t{0};
+ *   for_each_value<int32_t>(*chunk.get_column(column_id), [&](const int32_t value, const ChunkOffset) {
+ *     sum += value;
+ *   });
+ */
+template <typename T, typename Functor>
+void for_each_value(const BaseColumn& column, const Functor& func) {
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    const auto size = static_cast<ChunkOffset>(value_column->size());
+    for (ChunkOffset chunk_offset{0}; chunk_offset < size; ++chunk_offset) {
+      func(value_column->get_typed(chunk_offset), chunk_offset);
+    }
+  } else if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    const auto& dictionary = *dictionary_column->dictionary();
+    resolve_attribute_vector(*dictionary_column->attribute_vector(), [&](const auto& attribute_vector) {
+      const auto size = static_cast<ChunkOffset>(attribute_vector.size());
+      for (ChunkOffset chunk_offset{0}; chunk_offset < size; ++chunk_offset) {
+        func(dictionary[attribute_vector.get(chunk_offset)], chunk_offset);
+      }
+    });
+  } else if (const auto reference_column = dynamic_cast<const ReferenceColumn*>(&column)) {
+    const auto& referenced_table = *reference_column->referenced_table();
+    const auto& pos_list = *reference_column->pos_list();
+
+    // the referenced column is only looked up when the referenced chunk changes
+    auto current_chunk_id = INVALID_CHUNK_ID;
+    const ValueColumn<T>* referenced_value_column = nullptr;
+    const DictionaryColumn<T>* referenced_dictionary_column = nullptr;
+
+    const auto size = static_cast<ChunkOffset>(pos_list.size());
+    for (ChunkOffset chunk_offset{0}; chunk_offset < size; ++chunk_offset) {
+      const auto& row_id = pos_list[chunk_offset];
+      if (row_id == NULL_ROW_ID) continue;
+
+      if (row_id.chunk_id != current_chunk_id) {
+        current_chunk_id = row_id.chunk_id;
+        const auto& referenced_column =
+            *referenced_table.get_chunk(current_chunk_id).get_column(reference_column->referenced_column_id());
+        referenced_value_column = dynamic_cast<const ValueColumn<T>*>(&referenced_column);
+        referenced_dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&referenced_column);
+        Assert(referenced_value_column || referenced_dictionary_column, "Unsupported referenced column type");
+      }
+
+      if (referenced_value_column) {
+        func(referenced_value_column->get_typed(row_id.chunk_offset), chunk_offset);
+      } else {
+        func(referenced_dictionary_column->get(row_id.chunk_offset), chunk_offset);
+      }
+    }
+  } else {
+    Fail("Unsupported column type");
+  }
+}
+
+/**
+ * Like for_each_value, but also calls on_null(chunk_offset) for the positions that do not have a value, so that every
+ * position of the column is visited exactly once and in order.
+ */
+template <typename T, typename OnValue, typename OnNull>
+void for_each_value_or_null(const BaseColumn& column, const OnValue& on_value, const OnNull& on_null) {
+  auto next_offset = ChunkOffset{0};
+  for_each_value<T>(column, [&](const T& value, const ChunkOffset offset) {
+    for (; next_offset < offset; ++next_offset) on_null(next_offset);
+    on_value(value, offset);
+    next_offset = offset + 1;
+  });
+  for (; next_offset < column.size(); ++next_offset) on_null(next_offset);
+}
+
+}  // namespace opossum
@@ -0,0 +1,289 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/for_each_value.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/normalized_key.hpp"
+
+namespace opossum {
+
+// ARTNode is a node of the tree. Leaves are nodes without children and stand for a single key.
+class ARTNode {
+ public:
+  ARTNode(std::string prefix, const uint32_t begin, const uint32_t end)
+      : prefix(std::move(prefix)), begin(begin), end(end) {}
+  virtual ~ARTNode() = default;
+
+  // returns the child for the given key byte, or nullptr
+  virtual const ARTNode* child(const uint8_t byte) const = 0;
+
+  // returns the first child whose key byte is greater than the given one, or nullptr
+  virtual const ARTNode* next_child(const uint8_t byte) const = 0;
+
+  // the key bytes that all keys below the node share, following the byte that leads to the node
+  const std::string prefix;
+
+  // the offsets of all keys below the node are [begin, end) of the sorted positions
+  const uint32_t begin;
+  const uint32_t end;
+};
+
+namespace {
+
+// the children of an inner node with their key bytes, in ascending order
+using ARTChildren = std::vector<std::pair<uint8_t, std::unique_ptr<const ARTNode>>>;
+
+class ARTLeaf : public ARTNode {
+ public:
+  using ARTNode::ARTNode;
+
+  const ARTNode* child(const uint8_t) const override { return nullptr; }
+  const ARTNode* next_child(const uint8_t) const override { return nullptr; }
+};
+
+// Node4 and Node16 store the key bytes of their children in a sorted array that is searched linearly (Node16 with a
+// single SIMD comparison, if available)
+template <size_t capacity>
+class ARTSmallNode : public ARTNode {
+ public:
+  ARTSmallNode(std::string prefix, const uint32_t begin, const uint32_t end, ARTChildren children)
+      : ARTNode(std::move(prefix), begin, end), _child_count(static_cast<uint8_t>(children.size())) {
+    DebugAssert(children.size() <= capacity, "Too many children for node");
+    this->_key_bytes.fill(0);
+    for (size_t child_id = 0; child_id < children.size(); ++child_id) {
+      this->_key_bytes[child_id] = children[child_id].first;
+      this->_children[child_id] = std::move(children[child_id].second);
+    }
+  }
+
+  const ARTNode* child(const uint8_t byte) const override {
+#if defined(__SSE2__)
+    if constexpr (capacity == 16) {
+      const auto key_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(this->_key_bytes.data()));
+      const auto matches = _mm_cmpeq_epi8(key_bytes, _mm_set1_epi8(static_cast<char>(byte)));
+      const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(matches)) & ((1u << this->_child_count) - 1);
+      return mask ? this->_children[__builtin_ctz(mask)].get() : nullptr;
+    }
+#endif
+    for (uint8_t child_id = 0; child_id < this->_child_count; ++child_id) {
+      if (this->_key_bytes[child_id] == byte) return this->_children[child_id].get();
+    }
+    return nullptr;
+  }
+
+  const ARTNode* next_child(const uint8_t byte) const override {
+    for (uint8_t child_id = 0; child_id < this->_child_count; ++child_id) {
+      if (this->_key_bytes[child_id] > byte) return this->_children[child_id].get();
+    }
+    return nullptr;
+  }
+
+ protected:
+  const uint8_t _child_count;
+  std::array<uint8_t, capacity> _key_bytes;
+  std::array<std::unique_ptr<const ARTNode>, capacity> _children;
+};
+
+// Node48 maps every key byte to the slot of its child, so that it needs one indirection but only 48 child pointers
+class ARTNode48 : public ARTNode {
+ public:
+  ARTNode48(std::string prefix, const uint32_t begin, const uint32_t end, ARTChildren children)
+      : ARTNode(std::move(prefix), begin, end) {
+    DebugAssert(children.size() <= 48, "Too many children for node");
+    this->_child_slots.fill(NO_CHILD);
+    for (size_t child_id = 0; child_id < children.size(); ++child_id) {
+      this->_child_slots[children[child_id].first] = static_cast<uint8_t>(child_id);
+      this->_children[child_id] = std::move(children[child_id].second);
+    }
+  }
+
+  const ARTNode* child(const uint8_t byte) const override {
+    const auto slot = this->_child_slots[byte];
+    return slot == NO_CHILD ? nullptr : this->_children[slot].get();
+  }
+
+  const ARTNode* next_child(const uint8_t byte) const override {
+    for (auto next_byte = size_t{byte} + 1; next_byte < this->_child_slots.size(); ++next_byte) {
+      if (this->_child_slots[next_byte] != NO_CHILD) return this->_children[this->_child_slots[next_byte]].get();
+    }
+    return nullptr;
+  }
+
+ protected:
+  static constexpr auto NO_CHILD = uint8_t{0xFF};
+
+  std::array<uint8_t, 256> _child_slots;
+  std::array<std::unique_ptr<const ARTNode>, 48> _children;
+};
+
+// Node256 has a child pointer for every key byte
+class ARTNode256 : public ARTNode {
+ public:
+  ARTNode256(std::string prefix, const uint32_t begin, const uint32_t end, ARTChildren children)
+      : ARTNode(std::move(prefix), begin, end) {
+    for (auto& child : children) this->_children[child.first] = std::move(child.second);
+  }
+
+  const ARTNode* child(const uint8_t byte) const override { return this->_children[byte].get(); }
+
+  const ARTNode* next_child(const uint8_t byte) const override {
+    for (auto next_byte = size_t{byte} + 1; next_byte < this->_children.size(); ++next_byte) {
+      if (this->_children[next_byte]) return this->_children[next_byte].get();
+    }
+    return nullptr;
+  }
+
+ protected:
+  std::array<std::unique_ptr<const ARTNode>, 256> _children;
+};
+
+// Builds the node for the distinct keys [first_key, last_key), whose first depth bytes are consumed by the path to
+// the node. The offsets of key i are [key_begins[i], key_begins[i + 1]) of the sorted positions.
+// No key is a prefix of another one, as the normalized keys of each column are prefix-free. Thus, any two keys
+// differ at a position before either of them ends, and a node with a single key is a leaf.
+std::unique_ptr<const ARTNode> build_node(const std::vector<std::string>& keys, const std::vector<uint32_t>& key_begins,
+                                          const size_t first_key, const size_t last_key, const size_t depth) {
+  const auto begin = key_begins[first_key];
+  const auto end = key_begins[last_key];
+  if (last_key - first_key == 1) return std::make_unique<ARTLeaf>(keys[first_key].substr(depth), begin, end);
+
+  // as the keys are sorted, the bytes that the first and the last key share are shared by all of them
+  auto branch_depth = depth;
+  while (keys[first_key][branch_depth] == keys[last_key - 1][branch_depth]) ++branch_depth;
+  auto prefix = keys[first_key].substr(depth, branch_depth - depth);
+
+  ARTChildren children;
+  for (auto child_first_key = first_key; child_first_key < last_key;) {
+    const auto byte = keys[child_first_key][branch_depth];
+    auto child_last_key = child_first_key + 1;
+    while (child_last_key < last_key && keys[child_last_key][branch_depth] == byte) ++child_last_key;
+
+    children.emplace_back(static_cast<uint8_t>(byte),
+                          build_node(keys, key_begins, child_first_key, child_last_key, branch_depth + 1));
+    child_first_key = child_last_key;
+  }
+
+  if (children.size() <= 4) {
+    return std::make_unique<ARTSmallNode<4>>(std::move(prefix), begin, end, std::move(children));
+  } else if (children.size() <= 16) {
+    return std::make_unique<ARTSmallNode<16>>(std::move(prefix), begin, end, std::move(children));
+  } else if (children.size() <= 48) {
+    return std::make_unique<ARTNode48>(std::move(prefix), begin, end, std::move(children));
+  }
+  return std::make_unique<ARTNode256>(std::move(prefix), begin, end, std::move(children));
+}
+
+// appends the normalized keys of a column to the keys of its rows, and returns a function that does the same for a
+// search value
+template <typename T>
+std::function<void(std::string&, const AllTypeVariant&)> append_column_keys(hana::basic_type<T>,
+                                                                            const BaseColumn& column,
+                                                                            std::vector<std::string>& keys) {
+  for_each_value<T>(column, [&](const T& value, const ChunkOffset offset) {
+    append_normalized_key(keys[offset], value);
+  });
+
+  return [](std::string& key, const AllTypeVariant& value) { append_normalized_key(key, type_cast<T>(value)); };
+}
+
+}  // namespace
+
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
+    : BaseIndex(index_columns) {
+  const auto size = index_columns.front()->size();
+
+  std::vector<std::string> keys(size);
+  for (const auto& column : index_columns) {
+    Assert(column->size() == size, "Indexed columns must have the same size");
+    resolve_column_data_type(*column, [&](auto type) {
+      this->_key_encoders.push_back(append_column_keys(type, *column, keys));
+    });
+  }
+
+  // ties are broken by the offset, so that equal rows stay in chunk order
+  this->_positions.resize(size);
+  for (ChunkOffset offset{0}; offset < size; ++offset) this->_positions[offset] = offset;
+  std::sort(this->_positions.begin(), this->_positions.end(), [&](const ChunkOffset left, const ChunkOffset right) {
+    const auto comparison = keys[left].compare(keys[right]);
+    return comparison < 0 || (comparison == 0 && left < right);
+  });
+
+  if (size == 0) return;
+
+  std::vector<std::string> distinct_keys;
+  std::vector<uint32_t> key_begins;
+  for (uint32_t position = 0; position < size; ++position) {
+    auto& key = keys[this->_positions[position]];
+    if (!distinct_keys.empty() && distinct_keys.back() == key) continue;
+    distinct_keys.push_back(std::move(key));
+    key_begins.push_back(position);
+  }
+  key_begins.push_back(static_cast<uint32_t>(size));
+
+  this->_root = build_node(distinct_keys, key_begins, 0, distinct_keys.size(), 0);
+}
+
+AdaptiveRadixTreeIndex::~AdaptiveRadixTreeIndex() = default;
+
+std::string AdaptiveRadixTreeIndex::_key(const std::vector<AllTypeVariant>& values) const {
+  std::string key;
+  for (size_t column_index = 0; column_index < values.size(); ++column_index) {
+    this->_key_encoders[column_index](key, values[column_index]);
+  }
+  return key;
+}
+
+size_t AdaptiveRadixTreeIndex::_bound(const std::string& key, const bool upper) const {
+  if (!this->_root) return 0;
+
+  const auto* node = this->_root.get();
+  auto depth = size_t{0};
+  while (true) {
+    // compare the node's prefix with the corresponding bytes of the search key
+    const auto length = std::min(node->prefix.size(), key.size() - depth);
+    const auto comparison = node->prefix.compare(0, length, key, depth, length);
+    if (comparison < 0) return node->end;
+    if (comparison > 0) return node->begin;
+    depth += length;
+
+    // all keys below the node start with the search key
+    if (depth == key.size()) return upper ? node->end : node->begin;
+
+    // the key continues, so it either belongs to a child or lies between two of them (or after a leaf)
+    const auto byte = static_cast<uint8_t>(key[depth]);
+    if (const auto child = node->child(byte)) {
+      node = child;
+      ++depth;
+      continue;
+    }
+
+    const auto next_child = node->next_child(byte);
+    return next_child ? next_child->begin : node->end;
+  }
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return this->_positions.cbegin() + this->_bound(this->_key(values), false);
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return this->_positions.cbegin() + this->_bound(this->_key(values), true);
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return this->_positions.cbegin(); }
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return this->_positions.cend(); }
+
+}  // namespace opossum
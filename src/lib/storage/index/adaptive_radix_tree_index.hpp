@@ -0,0 +1,51 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_index.hpp"
+
+namespace opossum {
+
+class ARTNode;
+
+// AdaptiveRadixTreeIndex is an adaptive radix tree (Leis et al., "The Adaptive Radix Tree: ARTful Indexing for
+// Main-Memory Databases", ICDE 2013) over the values of one or more ValueColumns or DictionaryColumns of any type.
+//
+// The values of each row are encoded as a normalized key (see normalized_key.hpp), which compares bytewise like the
+// values. The tree branches on one key byte per level, using nodes with 4, 16, 48, or 256 children depending on how
+// many different bytes occur, so that sparse levels stay small and dense levels take a single array access. Bytes
+// that all keys below a node share are stored in the node instead of a chain of single-child nodes (path
+// compression), so that the height only depends on where keys differ, not on their length.
+//
+// The offsets are stored sorted by key, and each node covers the contiguous range of offsets of the keys below it.
+// A lookup therefore descends the tree once and returns the bound of the node it stops at.
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+  ~AdaptiveRadixTreeIndex() override;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+
+  // returns the normalized key of the given values of the first values.size() columns
+  std::string _key(const std::vector<AllTypeVariant>& values) const;
+
+  // returns the position of the first offset whose key is not less than (or, for upper, not less than or starting
+  // with) the given key
+  size_t _bound(const std::string& key, const bool upper) const;
+
+  // one per indexed column, appends the normalized key of a value to a key
+  std::vector<std::function<void(std::string&, const AllTypeVariant&)>> _key_encoders;
+
+  // nullptr if the chunk is empty
+  std::unique_ptr<const ARTNode> _root;
+  std::vector<ChunkOffset> _positions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#include "base_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseIndex::BaseIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
+    : _index_columns(index_columns) {
+  Assert(!index_columns.empty(), "An index needs at least one column");
+}
+
+BaseIndex::Iterator BaseIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(!values.empty() && values.size() <= this->_index_columns.size(),
+              "Need one value for each of the first n indexed columns");
+  return this->_lower_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(!values.empty() && values.size() <= this->_index_columns.size(),
+              "Need one value for each of the first n indexed columns");
+  return this->_upper_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::cbegin() const { return this->_cbegin(); }
+
+BaseIndex::Iterator BaseIndex::cend() const { return this->_cend(); }
+
+const std::vector<std::shared_ptr<const BaseColumn>>& BaseIndex::index_columns() const {
+  return this->_index_columns;
+}
+
+bool BaseIndex::is_index_for(const std::vector<std::shared_ptr<const BaseColumn>>& columns) const {
+  if (columns.empty() || columns.size() > this->_index_columns.size()) return false;
+  return std::equal(columns.cbegin(), columns.cend(), this->_index_columns.cbegin());
+}
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+// BaseIndex is the abstract super class of all secondary indexes of a chunk. An index covers one or more columns of
+// the chunk and holds the chunk offsets of all rows, ordered by the values of the indexed columns (lexicographically,
+// the first column being the most significant one). Rows with equal values are ordered by their offset.
+//
+// lower_bound() and upper_bound() look up values of the first n indexed columns, so that [lower_bound(values),
+// upper_bound(values)) are the offsets of all rows starting with these values, and [cbegin(), lower_bound(values))
+// those of all smaller rows. Lookups on a prefix of the columns are supported; an index over (a, b) can be used to
+// find all rows with a given value of a.
+//
+// Indexes are created on immutable data (see Chunk::create_index()), they are not updated on later appends.
+class BaseIndex : private Noncopyable {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  explicit BaseIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+  virtual ~BaseIndex() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BaseIndex(BaseIndex&&) = default;
+  BaseIndex& operator=(BaseIndex&&) = default;
+
+  // returns an iterator to the first offset whose values are not less than the given values
+  Iterator lower_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // returns an iterator to the first offset whose values are greater than the given values
+  Iterator upper_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // returns iterators over the offsets of all rows, ordered by their values
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  // returns the indexed columns
+  const std::vector<std::shared_ptr<const BaseColumn>>& index_columns() const;
+
+  // returns whether the index can be used for lookups on the given columns, i.e., whether they are a prefix of the
+  // indexed columns
+  bool is_index_for(const std::vector<std::shared_ptr<const BaseColumn>>& columns) const;
+
+ protected:
+  // lookups are implemented by the subclasses, the number of values is checked beforehand
+  virtual Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _cbegin() const = 0;
+  virtual Iterator _cend() const = 0;
+
+  std::vector<std::shared_ptr<const BaseColumn>> _index_columns;
+};
+
+}  // namespace opossum
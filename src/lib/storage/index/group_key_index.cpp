@@ -0,0 +1,81 @@
+#include "group_key_index.hpp"
+
+#include <boost/hana/for_each.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "storage/dictionary_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// calls func(dictionary_column) if the column is a DictionaryColumn<T>
+template <typename T, typename Functor>
+void with_dictionary_column(hana::basic_type<T>, const std::shared_ptr<const BaseColumn>& column,
+                            const Functor& func) {
+  if (const auto dictionary_column = std::dynamic_pointer_cast<const DictionaryColumn<T>>(column)) {
+    func(dictionary_column);
+  }
+}
+
+}  // namespace
+
+GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
+    : BaseIndex(index_columns) {
+  Assert(index_columns.size() == 1, "GroupKeyIndex only supports a single column");
+
+  std::shared_ptr<const BaseAttributeVector> attribute_vector;
+  auto unique_values_count = size_t{0};
+  hana::for_each(types, [&](auto type) {
+    with_dictionary_column(type, index_columns.front(), [&](const auto& dictionary_column) {
+      attribute_vector = dictionary_column->attribute_vector();
+      unique_values_count = dictionary_column->unique_values_count();
+      // the lambdas keep the column alive, as does _index_columns
+      this->_dictionary_lower_bound = [dictionary_column](const AllTypeVariant& value) {
+        return dictionary_column->lower_bound(value);
+      };
+      this->_dictionary_upper_bound = [dictionary_column](const AllTypeVariant& value) {
+        return dictionary_column->upper_bound(value);
+      };
+    });
+  });
+  Assert(attribute_vector != nullptr, "GroupKeyIndex only supports DictionaryColumns");
+
+  // count the rows per value id, shifted by one so that the prefix sum yields the start of each group
+  this->_value_start_offsets.resize(unique_values_count + 1);
+  for (size_t chunk_offset = 0; chunk_offset < attribute_vector->size(); ++chunk_offset) {
+    ++this->_value_start_offsets[attribute_vector->get(chunk_offset) + 1];
+  }
+  for (size_t value_id = 1; value_id < this->_value_start_offsets.size(); ++value_id) {
+    this->_value_start_offsets[value_id] += this->_value_start_offsets[value_id - 1];
+  }
+
+  // filling the groups in chunk order keeps the offsets within each group sorted
+  auto next_positions = this->_value_start_offsets;
+  this->_positions.resize(attribute_vector->size());
+  for (ChunkOffset chunk_offset{0}; chunk_offset < attribute_vector->size(); ++chunk_offset) {
+    this->_positions[next_positions[attribute_vector->get(chunk_offset)]++] = chunk_offset;
+  }
+}
+
+BaseIndex::Iterator GroupKeyIndex::_group_begin(const ValueID value_id) const {
+  if (value_id == INVALID_VALUE_ID) return this->_positions.cend();
+  return this->_positions.cbegin() + this->_value_start_offsets[value_id];
+}
+
+BaseIndex::Iterator GroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return this->_group_begin(this->_dictionary_lower_bound(values.front()));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return this->_group_begin(this->_dictionary_upper_bound(values.front()));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_cbegin() const { return this->_positions.cbegin(); }
+
+BaseIndex::Iterator GroupKeyIndex::_cend() const { return this->_positions.cend(); }
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "base_index.hpp"
+
+namespace opossum {
+
+// GroupKeyIndex indexes a single DictionaryColumn. It groups the offsets of the chunk by their value id and stores,
+// for every value id, where its group starts. As the dictionary is sorted, the groups are ordered by value, and a
+// lookup only needs a binary search in the dictionary to find the value id and a single access to find its group.
+// Building the index is a counting sort over the value ids, which takes two passes over the attribute vector.
+class GroupKeyIndex : public BaseIndex {
+ public:
+  explicit GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+
+  // returns an iterator to the first offset of the group of the given value id
+  // INVALID_VALUE_ID, which the dictionary returns for values greater than all of its values, yields cend()
+  Iterator _group_begin(const ValueID value_id) const;
+
+  // the bounds of the column's dictionary, which are resolved to its type once
+  std::function<ValueID(const AllTypeVariant&)> _dictionary_lower_bound;
+  std::function<ValueID(const AllTypeVariant&)> _dictionary_upper_bound;
+
+  // the group of value id i is [_positions[_value_start_offsets[i]], _positions[_value_start_offsets[i + 1]])
+  std::vector<size_t> _value_start_offsets;
+  std::vector<ChunkOffset> _positions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,136 @@
+#include "sorted_position_index.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// BaseColumnComparator compares the values of an indexed column without knowing their type
+class BaseColumnComparator {
+ public:
+  virtual ~BaseColumnComparator() = default;
+
+  // returns a negative number, zero, or a positive number if the value at the left offset is smaller than, equal
+  // to, or greater than the value at the right offset
+  virtual int compare(const ChunkOffset left, const ChunkOffset right) const = 0;
+
+  // returns a function that compares the value at an offset with the given value in the same way
+  virtual std::function<int(ChunkOffset)> compare_with(const AllTypeVariant& value) const = 0;
+};
+
+namespace {
+
+template <typename T>
+int three_way_compare(const T& left, const T& right) {
+  if (left < right) return -1;
+  if (right < left) return 1;
+  return 0;
+}
+
+template <typename T>
+class ColumnComparator : public BaseColumnComparator {
+ public:
+  ColumnComparator(const ValueColumn<T>* value_column, const DictionaryColumn<T>* dictionary_column)
+      : _value_column(value_column), _dictionary_column(dictionary_column) {}
+
+  int compare(const ChunkOffset left, const ChunkOffset right) const override {
+    if (this->_dictionary_column) {
+      const auto& attribute_vector = *this->_dictionary_column->attribute_vector();
+      return three_way_compare(attribute_vector.get(left), attribute_vector.get(right));
+    }
+    return three_way_compare(this->_value_column->get_typed(left), this->_value_column->get_typed(right));
+  }
+
+  std::function<int(ChunkOffset)> compare_with(const AllTypeVariant& value) const override {
+    return [this, typed_value = type_cast<T>(value)](const ChunkOffset offset) {
+      if (this->_dictionary_column) {
+        const auto value_id = this->_dictionary_column->attribute_vector()->get(offset);
+        return three_way_compare(this->_dictionary_column->value_by_value_id(value_id), typed_value);
+      }
+      return three_way_compare(this->_value_column->get_typed(offset), typed_value);
+    };
+  }
+
+ protected:
+  // exactly one of them is set
+  const ValueColumn<T>* const _value_column;
+  const DictionaryColumn<T>* const _dictionary_column;
+};
+
+template <typename T>
+std::shared_ptr<const BaseColumnComparator> make_typed_comparator(hana::basic_type<T>, const BaseColumn& column) {
+  return std::make_shared<ColumnComparator<T>>(dynamic_cast<const ValueColumn<T>*>(&column),
+                                               dynamic_cast<const DictionaryColumn<T>*>(&column));
+}
+
+std::shared_ptr<const BaseColumnComparator> make_comparator(const BaseColumn& column) {
+  std::shared_ptr<const BaseColumnComparator> comparator;
+  resolve_column_data_type(column, [&](auto type) { comparator = make_typed_comparator(type, column); });
+  return comparator;
+}
+
+}  // namespace
+
+SortedPositionIndex::SortedPositionIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
+    : BaseIndex(index_columns) {
+  for (const auto& column : index_columns) {
+    Assert(column->size() == index_columns.front()->size(), "Indexed columns must have the same size");
+    this->_comparators.push_back(make_comparator(*column));
+  }
+
+  this->_positions.resize(index_columns.front()->size());
+  std::iota(this->_positions.begin(), this->_positions.end(), ChunkOffset{0});
+
+  // ties are broken by the offset, so that equal rows stay in chunk order
+  std::sort(this->_positions.begin(), this->_positions.end(), [&](const ChunkOffset left, const ChunkOffset right) {
+    for (const auto& comparator : this->_comparators) {
+      const auto comparison = comparator->compare(left, right);
+      if (comparison != 0) return comparison < 0;
+    }
+    return left < right;
+  });
+}
+
+std::function<int(ChunkOffset)> SortedPositionIndex::_make_comparison(
+    const std::vector<AllTypeVariant>& values) const {
+  std::vector<std::function<int(ChunkOffset)>> comparisons;
+  for (size_t column_index = 0; column_index < values.size(); ++column_index) {
+    comparisons.push_back(this->_comparators[column_index]->compare_with(values[column_index]));
+  }
+
+  return [comparisons = std::move(comparisons)](const ChunkOffset offset) {
+    for (const auto& comparison : comparisons) {
+      const auto result = comparison(offset);
+      if (result != 0) return result;
+    }
+    return 0;
+  };
+}
+
+BaseIndex::Iterator SortedPositionIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  const auto comparison = this->_make_comparison(values);
+  return std::partition_point(this->_positions.cbegin(), this->_positions.cend(),
+                              [&](const ChunkOffset offset) { return comparison(offset) < 0; });
+}
+
+BaseIndex::Iterator SortedPositionIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  const auto comparison = this->_make_comparison(values);
+  return std::partition_point(this->_positions.cbegin(), this->_positions.cend(),
+                              [&](const ChunkOffset offset) { return comparison(offset) <= 0; });
+}
+
+BaseIndex::Iterator SortedPositionIndex::_cbegin() const { return this->_positions.cbegin(); }
+
+BaseIndex::Iterator SortedPositionIndex::_cend() const { return this->_positions.cend(); }
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "base_index.hpp"
+
+namespace opossum {
+
+class BaseColumnComparator;
+
+// SortedPositionIndex holds the offsets of a chunk sorted by the values of one or more columns, which may be
+// ValueColumns or DictionaryColumns of any type. Lookups are binary searches over the sorted offsets that compare
+// the search values with the values of the columns, so the index itself only needs one ChunkOffset per row.
+// Dictionary columns are sorted on their value ids, which compare like their values.
+class SortedPositionIndex : public BaseIndex {
+ public:
+  explicit SortedPositionIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+
+  // returns a function that compares the values of the first values.size() columns at an offset with the given
+  // values, returning a negative number, zero, or a positive number like std::string::compare()
+  std::function<int(ChunkOffset)> _make_comparison(const std::vector<AllTypeVariant>& values) const;
+
+  // one per indexed column
+  std::vector<std::shared_ptr<const BaseColumnComparator>> _comparators;
+  std::vector<ChunkOffset> _positions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#include "reference_column.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "table.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+ReferenceColumn::ReferenceColumn(const std::shared_ptr<const Table> referenced_table,
+                                 const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
+    : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {
+  DebugAssert(referenced_column_id < referenced_table->col_count(), "Referenced column does not exist");
+}
+
+const AllTypeVariant ReferenceColumn::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+
+  const auto& row_id = this->_pos_list->at(i);
+  // e.g., the rows of an outer join without a partner. AllTypeVariant cannot hold NULL.
+  if (row_id == NULL_ROW_ID) Fail("ReferenceColumn cannot return the NULL at position " + std::to_string(i));
+
+  const auto& chunk = this->_referenced_table->get_chunk(row_id.chunk_id);
+  return (*chunk.get_column(this->_referenced_column_id))[row_id.chunk_offset];
+}
+
+void ReferenceColumn::append(const AllTypeVariant&) { Fail("ReferenceColumn is immutable"); }
+
+size_t ReferenceColumn::size() const { return this->_pos_list->size(); }
+
+const std::shared_ptr<const PosList> ReferenceColumn::pos_list() const { return this->_pos_list; }
+
+const std::shared_ptr<const Table> ReferenceColumn::referenced_table() const { return this->_referenced_table; }
+
+ColumnID ReferenceColumn::referenced_column_id() const { return this->_referenced_column_id; }
+
+}  // namespace opossum
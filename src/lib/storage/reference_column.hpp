@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// ReferenceColumn is a specific column type that stores all its values as position list of a referenced column.
+// Operators such as the TableScan emit tables of ReferenceColumns instead of copying the matching values.
+// A ReferenceColumn always refers to a table that stores actual data, never to another reference table.
+class ReferenceColumn : public BaseColumn {
+ public:
+  // creates a reference column
+  // the parameters specify the positions and the referenced column
+  ReferenceColumn(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
+                  const std::shared_ptr<const PosList> pos);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  // Fails for NULL_ROW_ID positions, as AllTypeVariant has no NULL.
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // reference columns are immutable
+  void append(const AllTypeVariant&) override;
+
+  // return the number of entries
+  size_t size() const override;
+
+  // returns the positions in the referenced table
+  const std::shared_ptr<const PosList> pos_list() const;
+
+  // returns the referenced table
+  const std::shared_ptr<const Table> referenced_table() const;
+
+  // returns the id of the referenced column
+  ColumnID referenced_column_id() const;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
+};
+
+}  // namespace opossum
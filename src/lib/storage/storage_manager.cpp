@@ -1,6 +1,9 @@
 #include "storage_manager.hpp"
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -15,36 +18,73 @@ StorageManager& StorageManager::get() {
 }
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  this->_tables.insert(std::make_pair(name, table));
+  std::lock_guard<std::mutex> lock(this->_write_mutex);
+  auto tables = std::make_shared<TableMap>(*this->_load_tables());
+  tables->insert(std::make_pair(name, table));
+  this->_store_tables(std::move(tables));
 }
 
 void StorageManager::drop_table(const std::string& name) {
-  if (!this->has_table(name)) throw std::runtime_error("No such table");
-
-  this->_tables.erase(name);
+  std::lock_guard<std::mutex> lock(this->_write_mutex);
+  auto tables = std::make_shared<TableMap>(*this->_load_tables());
+  if (tables->erase(name) == 0) throw std::runtime_error("No such table");
+  this->_store_tables(std::move(tables));
 }
 
-std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const { return this->_tables.at(name); }
+std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
+  return this->_load_tables()->at(name);
+}
 
 bool StorageManager::has_table(const std::string& name) const {
-  return this->_tables.find(name) != this->_tables.end();
+  const auto& tables = this->_load_tables();
+  return tables->find(name) != tables->end();
 }
 
 std::vector<std::string> StorageManager::table_names() const {
+  const auto& tables = this->_load_tables();
   std::vector<std::string> result;
-  for (auto& table : this->_tables) {
+  for (auto& table : *tables) {
     result.push_back(table.first);
   }
   return result;
 }
 
 void StorageManager::print(std::ostream& out) const {
-  for (auto& table : this->_tables) {
+  const auto& tables = this->_load_tables();
+  for (auto& table : *tables) {
     out << table.first << table.second->col_count() << table.second->row_count() << table.second->chunk_count()
         << std::endl;
   }
 }
 
-void StorageManager::reset() { get() = StorageManager(); }
+void StorageManager::reset() {
+  auto& instance = get();
+  std::lock_guard<std::mutex> lock(instance._write_mutex);
+  instance._store_tables(std::make_shared<const TableMap>());
+}
+
+const std::shared_ptr<const StorageManager::TableMap>& StorageManager::_load_tables() const {
+  struct CachedTables {
+    const StorageManager* storage_manager = nullptr;
+    uint64_t version = 0;
+    std::shared_ptr<const TableMap> tables;
+  };
+  thread_local CachedTables cache;
+
+  // _store_tables() replaces the map before it increments the version, so a map loaded after reading a version is at
+  // least as recent as that version
+  const auto version = this->_version.load(std::memory_order_acquire);
+  if (cache.storage_manager != this || cache.version != version) {
+    cache.tables = std::atomic_load(&this->_tables);
+    cache.storage_manager = this;
+    cache.version = version;
+  }
+  return cache.tables;
+}
+
+void StorageManager::_store_tables(std::shared_ptr<const TableMap> tables) {
+  std::atomic_store(&this->_tables, std::move(tables));
+  this->_version.fetch_add(1, std::memory_order_release);
+}
 
 }  // namespace opossum
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -14,6 +17,12 @@ namespace opossum {
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+// All methods are thread-safe. The tables are kept in an immutable map that is replaced as a whole when a table is
+// added or dropped (copy-on-write), which bumps a version counter. Each thread caches the map it loaded last, and
+// lookups only compare the cached version with the current one. Thus, lookups neither take a lock nor write to memory
+// shared with other threads (such as the reference count of the map) unless the map changed. Writers copy the map
+// under a mutex, which is fine as tables are added and dropped rarely. Note that a dropped table is only freed once
+// each thread that looked up tables before has done so again.
 class StorageManager : private Noncopyable {
  public:
   static StorageManager& get();
@@ -43,8 +52,21 @@ class StorageManager : private Noncopyable {
 
  protected:
   StorageManager() {}
-  StorageManager& operator=(StorageManager&&) = default;
 
-  std::unordered_map<std::string, std::shared_ptr<Table>> _tables;
+  using TableMap = std::unordered_map<std::string, std::shared_ptr<Table>>;
+
+  // returns the current map of tables from the cache of the calling thread, which stays valid until the thread calls
+  // this again
+  const std::shared_ptr<const TableMap>& _load_tables() const;
+
+  // replaces the map of tables, _write_mutex has to be held
+  void _store_tables(std::shared_ptr<const TableMap> tables);
+
+  // only accessed through std::atomic_load and std::atomic_store
+  std::shared_ptr<const TableMap> _tables = std::make_shared<const TableMap>();
+  // incremented after each change of _tables, so that threads notice that their cached map is outdated
+  std::atomic<uint64_t> _version{0};
+  // serializes writers, which copy the map and replace it
+  std::mutex _write_mutex;
 };
 }  // namespace opossum
@@ -2,22 +2,36 @@
 
 #include <algorithm>
 #include <iomanip>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "dictionary_column.hpp"
 #include "value_column.hpp"
+#include "zone_map.hpp"
 
 #include "resolve_type.hpp"
+#include "statistics/table_statistics.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-Table::Table(const uint32_t chunk_size) : _chunks(), _column_names(), _column_types(), _max_chunk_size(chunk_size) {
+Table::Table(const uint32_t chunk_size, std::shared_ptr<std::pmr::memory_resource> memory_resource)
+    : _chunks(),
+      _column_names(),
+      _column_types(),
+      _max_chunk_size(chunk_size),
+      _memory_resource(std::move(memory_resource)),
+      _append_mutex(std::make_unique<std::mutex>()),
+      _seal_mutex(std::make_unique<std::mutex>()),
+      _table_statistics(std::make_shared<TableStatistics>()) {
   create_new_chunk();
 }
 
@@ -29,30 +43,279 @@ void Table::add_column_definition(const std::string& name, const std::string& ty
 void Table::add_column(const std::string& name, const std::string& type) {
   this->add_column_definition(name, type);
   for (auto& chunk : this->_chunks) {
-    chunk->add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(type));
+    auto column = this->_make_value_column(type);
+    // only the last chunk still receives rows, unless it is sealed as well
+    if (this->_max_chunk_size > 0 && chunk == this->_chunks.back() && !chunk->is_sealed()) {
+      column->reserve(this->_max_chunk_size);
+    }
+    chunk->add_column(column);
   }
 }
 
-void Table::append(std::vector<AllTypeVariant> values) {
-  if (this->_max_chunk_size > 0 && this->_chunks.back()->size() >= _max_chunk_size) {
-    create_new_chunk();
-  }
+void Table::append(const std::vector<AllTypeVariant>& values) {
+  if (this->_last_chunk_is_closed()) create_new_chunk();
 
   this->_chunks.back()->append(values);
 }
 
+void Table::append_concurrently(const std::vector<AllTypeVariant>& values) {
+  Assert(this->_max_chunk_size > 0, "Concurrent appends need a maximum chunk size");
+  DebugAssert(values.size() == this->_column_types.size(), "Row needs exactly one value per column");
+
+  while (true) {
+    auto append_buffer = std::atomic_load(&this->_append_buffer);
+    if (!append_buffer) {
+      // the first concurrent append creates the staging chunk, and the spare one that replaces it once it is full
+      std::lock_guard<std::mutex> lock(*this->_append_mutex);
+      if (!std::atomic_load(&this->_append_buffer)) {
+        std::atomic_store(&this->_append_buffer, this->_make_append_buffer());
+        this->_spare_append_buffer = this->_make_append_buffer();
+      }
+      continue;
+    }
+
+    const auto chunk_offset = append_buffer->reserved_rows.fetch_add(1);
+    if (chunk_offset >= this->_max_chunk_size) {
+      // The staging chunk is full and the writer of its last row is about to replace it. We wait for the new one
+      // without touching reserved_rows again, as retrying the fetch_add could eventually overflow it.
+      while (std::atomic_load(&this->_append_buffer) == append_buffer) {
+        std::this_thread::yield();
+      }
+      continue;
+    }
+
+    for (ColumnID column_id{0}; column_id < values.size(); ++column_id) {
+      append_buffer->column_setters[column_id](chunk_offset, values[column_id]);
+    }
+
+    // the fetch_add chain on written_rows makes all writes to this chunk visible to the thread that seals it
+    if (append_buffer->written_rows.fetch_add(1) + 1 == this->_max_chunk_size) {
+      this->_seal_append_buffer(append_buffer, this->_max_chunk_size);
+    }
+    return;
+  }
+}
+
+void Table::flush_concurrent_appends() {
+  auto append_buffer = std::atomic_load(&this->_append_buffer);
+  if (!append_buffer) return;
+
+  const auto row_count = append_buffer->written_rows.load();
+  DebugAssert(row_count == append_buffer->reserved_rows.load(), "Concurrent appends are still running");
+  if (row_count == 0) return;
+
+  this->_seal_append_buffer(append_buffer, row_count);
+}
+
+bool Table::_last_chunk_is_closed() const {
+  // a sealed chunk, e.g., the partial chunk of flush_concurrent_appends(), already has zone maps and statistics that
+  // further rows would not be part of
+  const auto& last_chunk = *this->_chunks.back();
+  return last_chunk.is_sealed() || (this->_max_chunk_size > 0 && last_chunk.size() >= this->_max_chunk_size);
+}
+
+std::shared_ptr<BaseColumn> Table::_make_value_column(const std::string& type) const {
+  if (!this->_memory_resource) return make_shared_by_column_type<BaseColumn, ValueColumn>(type);
+  return make_shared_by_column_type<BaseColumn, ValueColumn>(type, this->_memory_resource);
+}
+
+std::shared_ptr<Table::AppendBuffer> Table::_make_append_buffer() const {
+  auto append_buffer = std::make_shared<AppendBuffer>();
+  append_buffer->chunk = std::make_shared<Chunk>();
+
+  for (const auto& column_type : this->_column_types) {
+    resolve_data_type(column_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+
+      // the column is sized up front so that writers can fill their rows independently of each other
+      const auto memory_resource =
+          this->_memory_resource ? this->_memory_resource.get() : std::pmr::get_default_resource();
+      const auto column = std::make_shared<ValueColumn<Type>>(pmr_vector<Type>(this->_max_chunk_size, memory_resource),
+                                                              this->_memory_resource);
+      append_buffer->chunk->add_column(column);
+      append_buffer->column_setters.emplace_back(
+          [column = column.get()](ChunkOffset chunk_offset, const AllTypeVariant& value) {
+            column->values()[chunk_offset] = type_cast<Type>(value);
+          });
+    });
+  }
+
+  return append_buffer;
+}
+
+void Table::_seal_append_buffer(const std::shared_ptr<AppendBuffer>& append_buffer, ChunkOffset row_count) {
+  {
+    // Publishing the next staging chunk releases the writers waiting in append_concurrently(), so it happens first.
+    // The spare chunk is already allocated, so the writers do not wait for that either.
+    std::lock_guard<std::mutex> lock(*this->_append_mutex);
+    auto next_append_buffer = std::move(this->_spare_append_buffer);
+    if (!next_append_buffer) next_append_buffer = this->_make_append_buffer();
+    std::atomic_store(&this->_append_buffer, std::move(next_append_buffer));
+  }
+
+  // all rows of the full chunk are written, so it is sealed while the writers fill the next one
+  {
+    std::lock_guard<std::mutex> lock(*this->_seal_mutex);
+    if (row_count < this->_max_chunk_size) {
+      for (ColumnID column_id{0}; column_id < this->_column_types.size(); ++column_id) {
+        resolve_data_type(this->_column_types[column_id], [&](auto type) {
+          using Type = typename decltype(type)::type;
+          std::static_pointer_cast<ValueColumn<Type>>(append_buffer->chunk->get_column(column_id))
+              ->values()
+              .resize(row_count);
+        });
+      }
+      append_buffer->chunk->shrink_to_fit();
+    }
+    this->_seal_chunk(*append_buffer->chunk);
+
+    this->emplace_chunk(std::move(*append_buffer->chunk));
+  }
+
+  auto spare_append_buffer = this->_make_append_buffer();
+  std::lock_guard<std::mutex> lock(*this->_append_mutex);
+  if (!this->_spare_append_buffer) this->_spare_append_buffer = std::move(spare_append_buffer);
+}
+
+void Table::append_column_batch(const std::vector<std::shared_ptr<BaseColumn>>& batch) {
+  Assert(batch.size() == this->_column_types.size(), "Batch needs exactly one column per table column");
+  if (batch.empty()) return;
+
+  // everything is checked before the first values are moved, so that an invalid batch leaves the table unchanged
+  const auto batch_size = batch.front()->size();
+  for (ColumnID column_id{0}; column_id < this->_column_types.size(); ++column_id) {
+    Assert(batch[column_id]->size() == batch_size, "All columns of a batch need to have the same length");
+    resolve_data_type(this->_column_types[column_id], [&](auto type) {
+      using Type = typename decltype(type)::type;
+      Assert(std::dynamic_pointer_cast<ValueColumn<Type>>(batch[column_id]) != nullptr,
+             "Batch column does not match the column type");
+    });
+  }
+
+  auto begin = size_t{0};
+  while (begin < batch_size) {
+    if (this->_last_chunk_is_closed()) this->create_new_chunk();
+
+    auto& chunk = *this->_chunks.back();
+    auto end = batch_size;
+    if (this->_max_chunk_size > 0) {
+      end = std::min(batch_size, begin + (this->_max_chunk_size - chunk.size()));
+    }
+
+    for (ColumnID column_id{0}; column_id < this->_column_types.size(); ++column_id) {
+      resolve_data_type(this->_column_types[column_id], [&](auto type) {
+        using Type = typename decltype(type)::type;
+
+        const auto source_column = std::static_pointer_cast<ValueColumn<Type>>(batch[column_id]);
+        const auto target_column = std::static_pointer_cast<ValueColumn<Type>>(chunk.get_column(column_id));
+
+        auto& source_values = source_column->values();
+        if (begin == 0 && end == batch_size) {
+          // the whole batch fits into the chunk, so we can hand over the vector itself
+          target_column->append_values(std::move(source_values));
+        } else {
+          target_column->append_values(pmr_vector<Type>(std::make_move_iterator(source_values.begin() + begin),
+                                                        std::make_move_iterator(source_values.begin() + end),
+                                                        target_column->values().get_allocator()));
+        }
+      });
+    }
+
+    begin = end;
+  }
+}
+
 void Table::create_new_chunk() {
+  // the current last chunk will not receive further rows, so it gives back the memory it reserved but did not fill
+  // and is sealed, unless it was sealed before, e.g., by append_concurrently()
+  if (!this->_chunks.empty()) {
+    auto& last_chunk = *this->_chunks.back();
+    last_chunk.shrink_to_fit();
+    if (!last_chunk.is_sealed()) this->_seal_chunk(last_chunk);
+  }
+
   auto new_chunk = std::make_shared<Chunk>();
   for (auto& column_type : this->_column_types) {
-    new_chunk->add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(column_type));
+    new_chunk->add_column(this->_make_value_column(column_type));
   }
+  // allocating the full chunk once avoids the copies (and temporarily doubled memory) of growing vectors
+  if (this->_max_chunk_size > 0) new_chunk->reserve(this->_max_chunk_size);
   this->_chunks.push_back(new_chunk);
 }
 
+void Table::emplace_chunk(Chunk chunk) {
+  if (this->_chunks.size() == 1 && this->_chunks.back()->size() == 0) {
+    this->_chunks.back() = std::make_shared<Chunk>(std::move(chunk));
+  } else {
+    this->_chunks.push_back(std::make_shared<Chunk>(std::move(chunk)));
+  }
+}
+
+void Table::emplace_sealed_chunk(Chunk chunk) {
+  auto& last_chunk = *this->_chunks.back();
+  if (last_chunk.size() > 0 && !last_chunk.is_sealed()) this->_seal_chunk(last_chunk);
+
+  this->_seal_chunk(chunk);
+  this->emplace_chunk(std::move(chunk));
+}
+
+TableStatistics Table::seal_detached_chunk(Chunk& chunk) const {
+  DebugAssert(!chunk.is_sealed(), "Chunk is already sealed");
+  chunk.set_zone_maps(create_zone_maps(chunk, this->_column_types));
+  chunk.mark_as_sealed();
+
+  TableStatistics chunk_statistics;
+  chunk_statistics.add_chunk(chunk, this->_column_types);
+  return chunk_statistics;
+}
+
+void Table::emplace_sealed_chunk(Chunk chunk, TableStatistics chunk_statistics) {
+  DebugAssert(chunk.is_sealed(), "Chunk has to be sealed by seal_detached_chunk()");
+  auto& last_chunk = *this->_chunks.back();
+  if (last_chunk.size() > 0 && !last_chunk.is_sealed()) this->_seal_chunk(last_chunk);
+
+  this->_table_statistics->merge(std::move(chunk_statistics));
+  this->emplace_chunk(std::move(chunk));
+}
+
+void Table::compress_chunk(ChunkID chunk_id) {
+  const auto& chunk = this->get_chunk(chunk_id);
+
+  auto compressed_chunk = std::make_shared<Chunk>();
+  for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+    const auto& column_type = this->_column_types[column_id];
+    compressed_chunk->add_column(
+        make_shared_by_column_type<BaseColumn, DictionaryColumn>(column_type, chunk.get_column(column_id)));
+  }
+
+  // the values, and thus the zone maps and statistics, do not change, so a sealed chunk stays sealed
+  compressed_chunk->set_zone_maps(create_zone_maps(*compressed_chunk, this->_column_types));
+  if (chunk.is_sealed()) compressed_chunk->mark_as_sealed();
+  this->_chunks[chunk_id] = compressed_chunk;
+
+  // compressed chunks are immutable, so further rows go into a new chunk, which seals the compressed one unless it
+  // was sealed before
+  if (chunk_id + 1 == this->chunk_count()) this->create_new_chunk();
+}
+
+std::shared_ptr<const TableStatistics> Table::table_statistics() const { return this->_table_statistics; }
+
+void Table::_seal_chunk(Chunk& chunk) {
+  DebugAssert(!chunk.is_sealed(), "Chunk is already sealed");
+  chunk.set_zone_maps(create_zone_maps(chunk, this->_column_types));
+  chunk.mark_as_sealed();
+  this->_table_statistics->add_chunk(chunk, this->_column_types);
+}
+
 uint16_t Table::col_count() const { return this->_chunks.front()->col_count(); }
 
 uint64_t Table::row_count() const {
-  return this->_max_chunk_size * (this->chunk_count() - 1) + this->_chunks.back()->size();
+  // compressing the last chunk seals it before it is full, so we cannot derive the count from the chunk size
+  uint64_t row_count = 0;
+  for (const auto& chunk : this->_chunks) {
+    row_count += chunk->size();
+  }
+  return row_count;
 }
 
 ChunkID Table::chunk_count() const { return ChunkID{static_cast<uint32_t>(this->_chunks.size())}; }
@@ -60,13 +323,17 @@ ChunkID Table::chunk_count() const { return ChunkID{static_cast<uint32_t>(this->
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   auto it = std::find(this->_column_names.begin(), this->_column_names.end(), column_name);
 
-  if (it != this->_column_names.end()) return ColumnID{it - this->_column_names.begin()};
+  if (it != this->_column_names.end()) {
+    return ColumnID{static_cast<ColumnID::base_type>(it - this->_column_names.begin())};
+  }
 
   throw std::runtime_error("Column not found");
 }
 
 uint32_t Table::chunk_size() const { return this->_max_chunk_size; }
 
+const std::shared_ptr<std::pmr::memory_resource>& Table::memory_resource() const { return this->_memory_resource; }
+
 const std::vector<std::string>& Table::column_names() const { return this->_column_names; }
 
 const std::string& Table::column_name(ColumnID column_id) const { return this->_column_names.at(column_id); }
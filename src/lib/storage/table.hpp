@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory_resource>
+
+#include <atomic>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -24,7 +28,10 @@ class Table : private Noncopyable {
   // creates a table
   // the parameter specifies the maximum chunk size, i.e., partition size
   // default (0) is an unlimited size. A table holds always at least one chunk
-  explicit Table(const uint32_t chunk_size = 0);
+  // The ValueColumns that the table creates allocate their values from the given memory resource, e.g., a
+  // ColumnArena, or from the default resource if there is none. Chunks that are added to the table keep the memory
+  // resource of their columns.
+  explicit Table(const uint32_t chunk_size = 0, std::shared_ptr<std::pmr::memory_resource> memory_resource = nullptr);
 
   // we need to explicitly set the move constructor to default when
   // we overwrite the copy constructor
@@ -63,6 +70,9 @@ class Table : private Noncopyable {
   // return the maximum chunk size (cannot exceed ChunkOffset (uint32_t))
   uint32_t chunk_size() const;
 
+  // returns the memory resource of the ValueColumns that the table creates, nullptr for the default resource
+  const std::shared_ptr<std::pmr::memory_resource>& memory_resource() const;
+
   // adds column definition without creating the actual columns
   // this is helpful when, e.g., an operator first creates the structure of the table
   // and then adds chunk by chunk
@@ -74,15 +84,92 @@ class Table : private Noncopyable {
 
   // inserts a row at the end of the table
   // note this is slow and not thread-safe and should be used for testing purposes only
-  void append(std::vector<AllTypeVariant> values);
-
-  // creates a new chunk and appends it
+  void append(const std::vector<AllTypeVariant>& values);
+
+  // inserts a row at the end of the table and may be called by many threads at the same time
+  // rows are written into a staging chunk that only becomes part of the table once it is full (i.e., it holds
+  // chunk_size() rows) or flush_concurrent_appends() is called, so the table must have a maximum chunk size
+  // the order of concurrently appended rows is not specified. Do not mix this with append() or append_column_batch()
+  // before flush_concurrent_appends(); afterwards, those start a new chunk
+  void append_concurrently(const std::vector<AllTypeVariant>& values);
+
+  // adds the partially filled staging chunk of append_concurrently() to the table
+  // must not run concurrently with append_concurrently()
+  void flush_concurrent_appends();
+
+  // appends a batch of rows given column by column, i.e., one ValueColumn of the matching type per column
+  // the values are moved out of the batch (leaving it in an unspecified state) and split into chunks of at most
+  // chunk_size() rows
+  // this is the fast path for bulk loads, as it neither boxes nor casts single values
+  void append_column_batch(const std::vector<std::shared_ptr<BaseColumn>>& batch);
+
+  // creates a new chunk with room for chunk_size() rows and appends it
+  // the previous last chunk is sealed, as it will not receive further rows: it is shrunk to its actual size and its
+  // zone maps are computed
   void create_new_chunk();
 
+  // adds a chunk that already holds all columns, e.g., an operator result
+  // if the table only has its initial, empty chunk, it is replaced
+  void emplace_chunk(Chunk chunk);
+
+  // adds a chunk that will not receive further rows, e.g., a loaded one, and seals it (see create_new_chunk())
+  // the previous last chunk is sealed as well. Call create_new_chunk() afterwards if rows are to be appended
+  void emplace_sealed_chunk(Chunk chunk);
+
+  // Seals a chunk that is not part of the table yet and returns its statistics. As this does not change the table,
+  // loaders can seal their chunks in parallel jobs and then add them with emplace_sealed_chunk(), which only merges the
+  // statistics.
+  TableStatistics seal_detached_chunk(Chunk& chunk) const;
+
+  // adds a chunk that seal_detached_chunk() sealed, together with its statistics (see emplace_sealed_chunk())
+  void emplace_sealed_chunk(Chunk chunk, TableStatistics chunk_statistics);
+
+  // replaces the ValueColumns of the given chunk by DictionaryColumns
+  // compressed chunks are immutable, so compressing the last chunk also creates a new one for further inserts
+  void compress_chunk(ChunkID chunk_id);
+
+  // returns the statistics of the table, which cover all sealed chunks, i.e., all but the last one
+  std::shared_ptr<const TableStatistics> table_statistics() const;
+
  protected:
+  // the staging chunk of append_concurrently(). Writers reserve a row with reserved_rows and announce the completed
+  // write with written_rows. The writer that completes the last row adds the chunk to the table.
+  struct AppendBuffer {
+    std::shared_ptr<Chunk> chunk;
+    // one typed setter per column, so that writers do not have to resolve the column type for each value
+    std::vector<std::function<void(ChunkOffset, const AllTypeVariant&)>> column_setters;
+    std::atomic<ChunkOffset> reserved_rows{0};
+    std::atomic<ChunkOffset> written_rows{0};
+  };
+
+  // returns whether appended rows have to go into a new chunk, i.e., whether the last chunk is full or sealed
+  bool _last_chunk_is_closed() const;
+
+  // creates an empty ValueColumn that allocates from the memory resource of the table
+  std::shared_ptr<BaseColumn> _make_value_column(const std::string& type) const;
+
+  std::shared_ptr<AppendBuffer> _make_append_buffer() const;
+  void _seal_append_buffer(const std::shared_ptr<AppendBuffer>& append_buffer, ChunkOffset row_count);
+
+  // computes the zone maps of a chunk that will not receive further rows, marks it as sealed, and adds it to the
+  // statistics
+  void _seal_chunk(Chunk& chunk);
+
   std::vector<std::shared_ptr<Chunk>> _chunks;
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
   uint32_t _max_chunk_size;
+  std::shared_ptr<std::pmr::memory_resource> _memory_resource;
+
+  // only accessed through std::atomic_load and std::atomic_store
+  std::shared_ptr<AppendBuffer> _append_buffer;
+  // the allocated staging chunk that replaces _append_buffer once it is full, guarded by _append_mutex
+  std::shared_ptr<AppendBuffer> _spare_append_buffer;
+  // held in unique_ptrs to keep the table movable. _append_mutex guards replacing the staging chunk, _seal_mutex
+  // adding full staging chunks to the table, which writers do not wait for.
+  std::unique_ptr<std::mutex> _append_mutex;
+  std::unique_ptr<std::mutex> _seal_mutex;
+
+  std::shared_ptr<TableStatistics> _table_statistics;
 };
 }  // namespace opossum
@@ -1,9 +1,11 @@
 #include "value_column.hpp"
 
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -13,21 +15,86 @@
 
 namespace opossum {
 
+template <typename T>
+ValueColumn<T>::ValueColumn(std::shared_ptr<std::pmr::memory_resource> memory_resource)
+    : _memory_resource(std::move(memory_resource)), _values(this->_memory_resource.get()) {
+  DebugAssert(this->_memory_resource, "Use the default constructor for columns of the default memory resource");
+}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(pmr_vector<T>&& values, std::shared_ptr<std::pmr::memory_resource> memory_resource)
+    : _memory_resource(std::move(memory_resource)), _values(std::move(values)) {
+  DebugAssert(*this->_values.get_allocator().resource() ==
+                  (this->_memory_resource ? *this->_memory_resource : *std::pmr::get_default_resource()),
+              "The values were allocated from a memory resource that the column does not keep alive");
+}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(std::vector<T>&& values)
+    : _values(std::make_move_iterator(values.begin()), std::make_move_iterator(values.end())) {}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(const T* data, const size_t size, std::shared_ptr<const void> owner)
+    : _owns_values(false), _foreign_data(data), _foreign_size(size), _foreign_owner(std::move(owner)) {
+  Assert(!std::is_same_v<T, std::string>, "Only columns of fixed-width types can refer to foreign values");
+}
+
 template <typename T>
 const AllTypeVariant ValueColumn<T>::operator[](const size_t i) const {
   PerformanceWarning("operator[] used");
 
-  return this->_values.at(i);
+  Assert(i < this->size(), "Index out of range");
+  return this->data()[i];
 }
 
 template <typename T>
 void ValueColumn<T>::append(const AllTypeVariant& val) {
+  Assert(this->owns_values(), "Columns that refer to foreign values are immutable");
   this->_values.push_back(type_cast<T>(val));
 }
 
+template <typename T>
+void ValueColumn<T>::append_values(pmr_vector<T>&& values) {
+  Assert(this->owns_values(), "Columns that refer to foreign values are immutable");
+  if (this->_values.empty()) {
+    // moves the values one by one if they were allocated from another memory resource
+    this->_values = std::move(values);
+    return;
+  }
+
+  this->_values.insert(this->_values.end(), std::make_move_iterator(values.begin()),
+                       std::make_move_iterator(values.end()));
+}
+
+template <typename T>
+void ValueColumn<T>::reserve(const size_t capacity) {
+  Assert(this->owns_values(), "Columns that refer to foreign values are immutable");
+  this->_values.reserve(capacity);
+}
+
+template <typename T>
+void ValueColumn<T>::shrink_to_fit() {
+  // foreign values do not reserve anything, and a column with a memory resource of its own would only copy its values
+  // into a smaller allocation without giving the larger one back, as arenas do not free single allocations
+  if (this->_memory_resource) return;
+  this->_values.shrink_to_fit();
+}
+
 template <typename T>
 size_t ValueColumn<T>::size() const {
-  return this->_values.size();
+  return this->_owns_values ? this->_values.size() : this->_foreign_size;
+}
+
+template <typename T>
+const pmr_vector<T>& ValueColumn<T>::values() const {
+  Assert(this->owns_values(), "Column refers to foreign values, use data() instead");
+  return this->_values;
+}
+
+template <typename T>
+pmr_vector<T>& ValueColumn<T>::values() {
+  Assert(this->owns_values(), "Column refers to foreign values, use data() instead");
+  return this->_values;
 }
 
 EXPLICITLY_INSTANTIATE_COLUMN_TYPES(ValueColumn);
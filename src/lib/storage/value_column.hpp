@@ -9,22 +9,83 @@
 
 namespace opossum {
 
-// ValueColumn is a specific column type that stores all its values in a vector
+// ValueColumn is a specific column type that stores all its values in a vector.
+// The vector takes its memory from a std::pmr::memory_resource. Unless a column is given one, e.g., the ColumnArena
+// of its table or chunk, that is the default resource, i.e., new and delete.
+// Columns of fixed-width types can also refer to values that they do not own, e.g., those of a memory-mapped file
+// (see ImportBinary). Such columns are immutable and their values are only available through the typed accessors
+// and data(), not through values().
 template <typename T>
 class ValueColumn : public BaseColumn {
  public:
+  ValueColumn() = default;
+
+  // creates an empty column whose values are allocated from the given memory resource, which the column keeps alive
+  explicit ValueColumn(std::shared_ptr<std::pmr::memory_resource> memory_resource);
+
+  // creates a column that takes over the given values without copying them
+  // if they were allocated from a memory resource other than the default one, it has to be passed as well
+  explicit ValueColumn(pmr_vector<T>&& values, std::shared_ptr<std::pmr::memory_resource> memory_resource = nullptr);
+
+  // creates a column from a std::vector, whose values are moved into a vector of the default memory resource
+  // this copies values of fixed-width types, so producers on hot paths should build a pmr_vector instead
+  explicit ValueColumn(std::vector<T>&& values);
+
+  // creates a column that refers to size values at data instead of owning them
+  // the owner keeps the values alive for as long as the column exists
+  ValueColumn(const T* data, const size_t size, std::shared_ptr<const void> owner);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t i) const override;
 
   // add a value to the end
   void append(const AllTypeVariant& val) override;
 
+  // moves a batch of values to the end. If the column is empty and the batch was allocated from the same memory
+  // resource, it takes over the vector without copying.
+  void append_values(pmr_vector<T>&& values);
+
   // return the number of entries
   size_t size() const override;
 
+  void reserve(const size_t capacity) override;
+
+  void shrink_to_fit() override;
+
+  // returns all values, only valid if the column owns them
+  const pmr_vector<T>& values() const;
+  pmr_vector<T>& values();
+
+  // returns whether the column owns its values, i.e., whether it was not created from values it refers to
+  bool owns_values() const { return this->_owns_values; }
+
+  // Typed access for operators. These are defined here so that they can be inlined into tight loops, which
+  // neither construct AllTypeVariants nor go through a virtual call.
+
+  // return the value at a certain position without bounds checking
+  const T& get_typed(const ChunkOffset chunk_offset) const { return this->data()[chunk_offset]; }
+
+  // return a pointer to the contiguous values, valid until the column is modified
+  const T* data() const { return this->_owns_values ? this->_values.data() : this->_foreign_data; }
+
+  // iterate over the contiguous values
+  const T* cbegin() const { return this->data(); }
+  const T* cend() const { return this->data() + this->size(); }
+  const T* begin() const { return this->cbegin(); }
+  const T* end() const { return this->cend(); }
+
  protected:
+  // declared before the values so that it outlives them
+  std::shared_ptr<std::pmr::memory_resource> _memory_resource;
+
   // Implementation goes here
-  std::vector<T> _values;
+  pmr_vector<T> _values;
+
+  // used instead of _values if the column does not own its values
+  bool _owns_values = true;
+  const T* _foreign_data = nullptr;
+  size_t _foreign_size = 0;
+  std::shared_ptr<const void> _foreign_owner;
 };
 
 }  // namespace opossum
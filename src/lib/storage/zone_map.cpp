@@ -0,0 +1,83 @@
+#include "zone_map.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "chunk.hpp"
+#include "dictionary_column.hpp"
+#include "resolve_type.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+namespace {
+
+// NaN compares false to every value, so it breaks std::minmax_element and lies outside of any [min, max] range, even
+// though it matches != for every search value
+template <typename Iterator>
+bool contains_nan(const Iterator begin, const Iterator end) {
+  using T = typename std::iterator_traits<Iterator>::value_type;
+  if constexpr (std::is_floating_point_v<T>) {
+    return std::any_of(begin, end, [](const T& value) { return std::isnan(value); });
+  } else {
+    return false;
+  }
+}
+
+}  // namespace
+
+std::vector<std::optional<ZoneMap>> create_zone_maps(const Chunk& chunk, const std::vector<std::string>& column_types) {
+  std::vector<std::optional<ZoneMap>> zone_maps(chunk.col_count());
+  if (chunk.size() == 0) return zone_maps;
+
+  for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+    const auto column = chunk.get_column(column_id);
+
+    resolve_data_type(column_types[column_id], [&](auto type) {
+      using Type = typename decltype(type)::type;
+
+      if (const auto value_column = std::dynamic_pointer_cast<const ValueColumn<Type>>(column)) {
+        if (contains_nan(value_column->cbegin(), value_column->cend())) return;
+        const auto min_max = std::minmax_element(value_column->cbegin(), value_column->cend());
+        zone_maps[column_id] = ZoneMap{*min_max.first, *min_max.second};
+      } else if (const auto dictionary_column = std::dynamic_pointer_cast<const DictionaryColumn<Type>>(column)) {
+        // the dictionary is sorted
+        const auto& dictionary = *dictionary_column->dictionary();
+        if (contains_nan(dictionary.cbegin(), dictionary.cend())) return;
+        zone_maps[column_id] = ZoneMap{dictionary.front(), dictionary.back()};
+      }
+    });
+  }
+
+  return zone_maps;
+}
+
+std::optional<ZoneMap> merge_zone_maps(const std::vector<std::optional<ZoneMap>>& zone_maps,
+                                       const std::string& column_type) {
+  if (zone_maps.empty() || !zone_maps.front()) return std::nullopt;
+
+  auto merged_zone_map = *zone_maps.front();
+  auto complete = true;
+  resolve_data_type(column_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    for (const auto& zone_map : zone_maps) {
+      if (!zone_map) {
+        complete = false;
+        return;
+      }
+      if (get<Type>(zone_map->min) < get<Type>(merged_zone_map.min)) merged_zone_map.min = zone_map->min;
+      if (get<Type>(merged_zone_map.max) < get<Type>(zone_map->max)) merged_zone_map.max = zone_map->max;
+    }
+  });
+
+  if (!complete) return std::nullopt;
+  return merged_zone_map;
+}
+
+}  // namespace opossum
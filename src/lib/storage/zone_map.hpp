@@ -0,0 +1,60 @@
+#pragma once
+
+#include <optional>
+
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// A zone map holds the smallest and the largest value of a column within a chunk, both of the column's type.
+// Scans use it to skip chunks that cannot contain a match, which is very effective on columns whose values are
+// (roughly) ordered by insertion, e.g., timestamps.
+struct ZoneMap {
+  AllTypeVariant min;
+  AllTypeVariant max;
+};
+
+// Computes the zone maps of all columns of a chunk with the given column types, one per column. Columns of empty
+// chunks, ReferenceColumns, whose values belong to other chunks, and floating point columns with a NaN get none.
+std::vector<std::optional<ZoneMap>> create_zone_maps(const Chunk& chunk, const std::vector<std::string>& column_types);
+
+// Combines the zone maps of one column in several chunks into the zone map of a chunk that holds all of their values,
+// e.g., for a loader that computed them for parts of a chunk in parallel. If one of them is missing, so is the result.
+std::optional<ZoneMap> merge_zone_maps(const std::vector<std::optional<ZoneMap>>& zone_maps,
+                                       const std::string& column_type);
+
+// Returns whether a chunk with the given zone map may contain a value that satisfies value <scan_type> search_value
+// (or, for OpBetween, search_value <= value <= search_value2). If it returns false, the chunk can be skipped.
+template <typename T>
+bool zone_map_may_match(const ZoneMap& zone_map, const ScanType scan_type, const T& search_value,
+                        const T& search_value2) {
+  const auto& min = get<T>(zone_map.min);
+  const auto& max = get<T>(zone_map.max);
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return !(search_value < min) && !(max < search_value);
+    case ScanType::OpNotEquals:
+      return min < max || min < search_value || search_value < min;
+    case ScanType::OpLessThan:
+      return min < search_value;
+    case ScanType::OpLessThanEquals:
+      return !(search_value < min);
+    case ScanType::OpGreaterThan:
+      return search_value < max;
+    case ScanType::OpGreaterThanEquals:
+      return !(max < search_value);
+    case ScanType::OpBetween:
+      return !(search_value2 < min) && !(max < search_value);
+  }
+  return true;
+}
+
+}  // namespace opossum
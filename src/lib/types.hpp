@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory_resource>
+
 #include <cstdint>
 #include <iostream>
 #include <limits>
@@ -37,6 +39,9 @@ namespace opossum {
 using ChunkOffset = uint32_t;
 using AttributeVectorWidth = uint8_t;
 
+constexpr ChunkID INVALID_CHUNK_ID{std::numeric_limits<ChunkID::base_type>::max()};
+constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
+
 struct RowID {
   ChunkID chunk_id;
   ChunkOffset chunk_offset;
@@ -51,8 +56,43 @@ struct RowID {
   }
 };
 
+// refers to no row at all, e.g., the missing join partner of a row in the result of an outer join
+constexpr RowID NULL_ROW_ID{ChunkID{std::numeric_limits<ChunkID::base_type>::max()},
+                             std::numeric_limits<ChunkOffset>::max()};
+
 using PosList = std::vector<RowID>;
 
+// a vector whose memory comes from a std::pmr::memory_resource, e.g., a ColumnArena (see ValueColumn)
+template <typename T>
+using pmr_vector = std::vector<T, std::pmr::polymorphic_allocator<T>>;
+
+enum class ScanType {
+  OpEquals,
+  OpNotEquals,
+  OpLessThan,
+  OpLessThanEquals,
+  OpGreaterThan,
+  OpGreaterThanEquals,
+  OpBetween
+};
+
+// NULLs, i.e., positions of a ReferenceColumn that are NULL_ROW_ID, come first unless the mode says otherwise
+enum class OrderByMode {
+  Ascending,
+  Descending,
+  AscendingNullsLast,
+  DescendingNullsLast
+};
+
+enum class JoinMode {
+  Inner,
+  Left,
+  Right,
+  Outer,
+  Semi,
+  Anti
+};
+
 class Noncopyable {
  protected:
   Noncopyable() = default;
@@ -0,0 +1,40 @@
+#include "buffered_file_writer.hpp"
+
+#include <cstring>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BufferedFileWriter::BufferedFileWriter(const std::string& filename, const size_t buffer_size) : _buffer(buffer_size) {
+  DebugAssert(buffer_size > 0, "The buffer must not be empty");
+  // the stream does not need a buffer of its own
+  this->_stream.rdbuf()->pubsetbuf(nullptr, 0);
+  this->_stream.open(filename, std::ios::binary);
+  Assert(this->_stream.is_open(), "Cannot open " + filename + " for writing");
+}
+
+BufferedFileWriter::~BufferedFileWriter() {
+  this->_stream.write(this->_buffer.data(), static_cast<std::streamsize>(this->_buffered_size));
+}
+
+void BufferedFileWriter::flush() {
+  this->_stream.write(this->_buffer.data(), static_cast<std::streamsize>(this->_buffered_size));
+  this->_buffered_size = 0;
+  this->_stream.flush();
+  Assert(this->_stream.good(), "Writing the file failed");
+}
+
+void BufferedFileWriter::_flush_and_write(const void* data, const size_t size) {
+  this->flush();
+  if (size < this->_buffer.size()) {
+    std::memcpy(this->_buffer.data(), data, size);
+    this->_buffered_size = size;
+  } else {
+    this->_stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    Assert(this->_stream.good(), "Writing the file failed");
+  }
+}
+
+}  // namespace opossum
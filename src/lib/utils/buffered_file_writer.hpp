@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// BufferedFileWriter writes a file through a buffer of a fixed size, so that writers of many small pieces, e.g.,
+// single values, neither pay for a stream call per piece nor hold more than the buffer in memory. Pieces that do not
+// fit into the buffer are written directly. Call flush() once everything is written, as the destructor cannot report
+// errors.
+class BufferedFileWriter : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_BUFFER_SIZE = size_t{1} << 20;
+
+  explicit BufferedFileWriter(const std::string& filename, const size_t buffer_size = DEFAULT_BUFFER_SIZE);
+  ~BufferedFileWriter();
+
+  void write(const void* data, const size_t size) {
+    if (size <= this->_buffer.size() - this->_buffered_size) {
+      std::memcpy(this->_buffer.data() + this->_buffered_size, data, size);
+      this->_buffered_size += size;
+    } else {
+      this->_flush_and_write(data, size);
+    }
+  }
+
+  // writes the buffer to the file
+  void flush();
+
+ protected:
+  void _flush_and_write(const void* data, const size_t size);
+
+  std::ofstream _stream;
+  std::vector<char> _buffer;
+  size_t _buffered_size = 0;
+};
+
+}  // namespace opossum
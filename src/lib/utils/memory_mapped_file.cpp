@@ -0,0 +1,40 @@
+#include "memory_mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename) {
+  const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Cannot open " + filename + " for reading");
+
+  struct stat file_status;
+  const auto stat_result = fstat(file_descriptor, &file_status);
+  if (stat_result == 0) this->_size = static_cast<size_t>(file_status.st_size);
+
+  // mapping zero bytes fails, but there is nothing to read from an empty file anyway
+  if (stat_result == 0 && this->_size > 0) {
+    const auto mapping = mmap(nullptr, this->_size, PROT_READ, MAP_SHARED, file_descriptor, 0);
+    if (mapping != MAP_FAILED) this->_data = static_cast<const char*>(mapping);
+  }
+  // the mapping stays valid after the file is closed
+  close(file_descriptor);
+  Assert(stat_result == 0 && (this->_data || this->_size == 0), "Cannot map " + filename + " into memory");
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (this->_data) munmap(const_cast<char*>(this->_data), this->_size);
+}
+
+const char* MemoryMappedFile::data() const { return this->_data; }
+
+size_t MemoryMappedFile::size() const { return this->_size; }
+
+}  // namespace opossum
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// MemoryMappedFile maps a whole file read-only into memory for as long as it exists. Pages are only read from disk
+// when they are accessed, and processes that map the same file share them in the page cache.
+class MemoryMappedFile : private Noncopyable {
+ public:
+  explicit MemoryMappedFile(const std::string& filename);
+  ~MemoryMappedFile();
+
+  // nullptr for an empty file
+  const char* data() const;
+  size_t size() const;
+
+ protected:
+  const char* _data = nullptr;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
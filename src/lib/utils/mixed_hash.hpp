@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace opossum {
+
+// Returns a 64-bit hash of a value whose bits are all well distributed. std::hash is the identity for integers in
+// common standard libraries, so its bits are mixed (using the finalizer of MurmurHash3) to also spread values with
+// regular patterns, e.g., multiples of 1024, over all bits.
+template <typename T>
+uint64_t mixed_hash(const T& value) {
+  auto hash = static_cast<uint64_t>(std::hash<T>{}(value));
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9a53ca3d1a5ull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+}  // namespace opossum
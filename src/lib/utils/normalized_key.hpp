@@ -0,0 +1,104 @@
+#pragma once
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace opossum {
+
+/**
+ * Normalized keys are binary strings that compare bytewise (e.g., with std::string::operator<) like the values they
+ * encode. A normalized key of several values is the concatenation of their keys and compares like a tuple of the
+ * values, so that multi-column comparisons become a single memcmp and multi-column hash keys a single string.
+ *
+ *  - integers are stored big-endian with the sign bit flipped, so that negative numbers come first
+ *  - floating point numbers are stored big-endian with the sign bit set, or all bits flipped if they are negative.
+ *    -0.0 gets the same key as 0.0
+ *  - strings are stored as they are, followed by the terminator 0x00 0x00. A 0x00 within the string is stored as
+ *    0x00 0xFF, so that no key is a prefix of another one
+ *
+ * For a descending order, all bytes of the value's key are flipped.
+ *
+ * Example:
+ *
+ *   std::string key;
+ *   append_normalized_key(key, int32_t{-3});
+ *   append_normalized_key(key, std::string{"foo"}, true);
+ *
+ *   auto position = size_t{0};
+ *   const auto first = read_normalized_key<int32_t>(key, position);
+ *   const auto second = read_normalized_key<std::string>(key, position, true);
+ */
+template <typename T>
+void append_normalized_key(std::string& key, const T& value, const bool descending = false) {
+  const auto begin = key.size();
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto character : value) {
+      key.push_back(character);
+      if (character == '\0') key.push_back('\xff');
+    }
+    key.append(2, '\0');
+  } else {
+    static_assert(std::is_arithmetic_v<T> && (sizeof(T) == 4 || sizeof(T) == 8), "Unsupported type");
+    using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto sign_bit = Bits{1} << (sizeof(Bits) * CHAR_BIT - 1);
+
+    Bits bits;
+    if constexpr (std::is_floating_point_v<T>) {
+      const T normalized_value = value == T{0} ? T{0} : value;
+      std::memcpy(&bits, &normalized_value, sizeof(bits));
+      bits = (bits & sign_bit) ? ~bits : bits | sign_bit;
+    } else {
+      bits = static_cast<Bits>(value) ^ sign_bit;
+    }
+
+    for (auto shift = static_cast<int>(sizeof(Bits) * CHAR_BIT) - CHAR_BIT; shift >= 0; shift -= CHAR_BIT) {
+      key.push_back(static_cast<char>(bits >> shift));
+    }
+  }
+
+  if (descending) {
+    for (auto position = begin; position < key.size(); ++position) key[position] = static_cast<char>(~key[position]);
+  }
+}
+
+// decodes the value whose key starts at the given position of a normalized key and moves the position behind it
+template <typename T>
+T read_normalized_key(const std::string& key, size_t& position, const bool descending = false) {
+  const auto next_byte = [&]() {
+    const auto byte = static_cast<unsigned char>(key[position++]);
+    return static_cast<unsigned char>(descending ? ~byte : byte);
+  };
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    std::string value;
+    while (true) {
+      const auto byte = next_byte();
+      if (byte == 0) {
+        // 0x00 0x00 terminates the string, 0x00 0xFF is an escaped 0x00
+        if (next_byte() == 0) return value;
+      }
+      value.push_back(static_cast<char>(byte));
+    }
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto sign_bit = Bits{1} << (sizeof(Bits) * CHAR_BIT - 1);
+
+    auto bits = Bits{0};
+    for (size_t byte_id = 0; byte_id < sizeof(Bits); ++byte_id) bits = (bits << CHAR_BIT) | next_byte();
+
+    if constexpr (std::is_floating_point_v<T>) {
+      bits = (bits & sign_bit) ? bits & ~sign_bit : ~bits;
+      T value;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    } else {
+      return static_cast<T>(bits ^ sign_bit);
+    }
+  }
+}
+
+}  // namespace opossum
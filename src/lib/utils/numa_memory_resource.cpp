@@ -0,0 +1,61 @@
+#include "numa_memory_resource.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
+#include <memory_resource>
+
+#include <new>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+NumaMemoryResource::NumaMemoryResource(const int node_id)
+    : _node_id(node_id), _page_size(static_cast<size_t>(sysconf(_SC_PAGESIZE))) {
+  // the node mask passed to mbind is a single word
+  Assert(node_id >= 0 && node_id < 64, "NUMA nodes are numbered from 0 to 63");
+}
+
+int NumaMemoryResource::node_id() const { return this->_node_id; }
+
+void* NumaMemoryResource::do_allocate(size_t bytes, size_t alignment) {
+  // mappings are page-aligned
+  Assert(alignment <= this->_page_size, "Alignment exceeds the page size");
+
+  const auto size = this->_mapping_size(bytes);
+  const auto pointer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (pointer == MAP_FAILED) throw std::bad_alloc();
+
+#if defined(__linux__)
+  // The pages are only placed when they are first touched, which then happens on the preferred node. mbind is called
+  // directly so that there is no dependency on libnuma. It fails without NUMA support, in which case the pages are
+  // placed as usual.
+  const auto node_mask = 1ul << this->_node_id;
+  syscall(SYS_mbind, pointer, size, MPOL_PREFERRED, &node_mask, sizeof(node_mask) * 8 + 1, 0);
+#endif
+
+  return pointer;
+}
+
+void NumaMemoryResource::do_deallocate(void* pointer, size_t bytes, size_t) {
+  munmap(pointer, this->_mapping_size(bytes));
+}
+
+bool NumaMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  // memory from one resource can be given back to another one of the same node, as both simply unmap it
+  const auto other_numa_resource = dynamic_cast<const NumaMemoryResource*>(&other);
+  return other_numa_resource && other_numa_resource->_node_id == this->_node_id;
+}
+
+size_t NumaMemoryResource::_mapping_size(const size_t bytes) const {
+  if (bytes == 0) return this->_page_size;
+  return (bytes + this->_page_size - 1) / this->_page_size * this->_page_size;
+}
+
+}  // namespace opossum
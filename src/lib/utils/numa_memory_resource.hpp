@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory_resource>
+
+#include <cstddef>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// NumaMemoryResource allocates memory on a given NUMA node, e.g., the node of the workers that scan a table. Each
+// allocation is a mapping of whole pages that is bound to the node, so it is meant as the upstream of a ColumnArena
+// rather than for single values. The node is a preference: if it runs out of memory, or the system does not support
+// NUMA, the pages come from any node. Only Linux supports the preference, other systems map plain pages.
+class NumaMemoryResource : public std::pmr::memory_resource, private Noncopyable {
+ public:
+  explicit NumaMemoryResource(const int node_id);
+
+  int node_id() const;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  // rounds up to whole pages, which is what the mappings consist of, and to at least one
+  size_t _mapping_size(const size_t bytes) const;
+
+  const int _node_id;
+  const size_t _page_size;
+};
+
+}  // namespace opossum
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "scheduler/current_scheduler.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "type_cast.hpp"
@@ -157,6 +158,9 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& m) {
   return ::testing::AssertionSuccess();
 }
 
-BaseTest::~BaseTest() { StorageManager::reset(); }
+BaseTest::~BaseTest() {
+  StorageManager::reset();
+  CurrentScheduler::set(nullptr);
+}
 
 }  // namespace opossum
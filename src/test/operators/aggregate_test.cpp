@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/aggregate.hpp"
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/type_cast.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("region", "string");
+    _table->add_column("year", "int");
+    _table->add_column("revenue", "long");
+    _table->add_column("margin", "double");
+    _table->append({"EU", 2017, int64_t{10}, 0.5});
+    _table->append({"US", 2017, int64_t{20}, 0.25});
+    _table->append({"EU", 2016, int64_t{5}, 0.75});
+    _table->append({"EU", 2017, int64_t{30}, 1.0});
+    _table->append({"US", 2017, int64_t{40}, 0.5});
+    _table->append({"EU", 2016, int64_t{1}, 0.25});
+    _table->append({"APAC", 2016, int64_t{7}, 0.5});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // returns the output rows in a sorted order
+  static std::vector<std::vector<AllTypeVariant>> _rows(const std::shared_ptr<const Table>& table) {
+    std::vector<std::vector<AllTypeVariant>> rows;
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      for (ChunkOffset offset{0}; offset < chunk.size(); ++offset) {
+        std::vector<AllTypeVariant> row;
+        for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+          row.push_back((*chunk.get_column(column_id))[offset]);
+        }
+        rows.push_back(row);
+      }
+    }
+    std::sort(rows.begin(), rows.end());
+    return rows;
+  }
+
+  // aggregates enough groups for the partial aggregates to be merged in several partitions
+  void _test_many_groups() {
+    auto table = std::make_shared<Table>(1000);
+    table->add_column("a", "int");
+    for (auto row = 0; row < 40000; ++row) {
+      table->append({row % 20000});
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    const auto aggregates = std::vector<AggregateDefinition>{{ColumnID{0}, AggregateFunction::Count},
+                                                             {ColumnID{0}, AggregateFunction::Sum}};
+    // a single group by column is hashed by its values, two by their normalized key
+    const auto groupby_column_id_lists =
+        std::vector<std::vector<ColumnID>>{{ColumnID{0}}, {ColumnID{0}, ColumnID{0}}};
+    for (const auto& groupby_column_ids : groupby_column_id_lists) {
+      auto aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids);
+      aggregate->execute();
+
+      const auto rows = _rows(aggregate->get_output());
+      ASSERT_EQ(rows.size(), 20000u);
+      for (auto group = 0; group < 20000; ++group) {
+        EXPECT_EQ(type_cast<int>(rows[group].front()), group);
+        EXPECT_EQ(type_cast<int64_t>(rows[group][groupby_column_ids.size()]), 2);
+        EXPECT_EQ(type_cast<int64_t>(rows[group].back()), 2 * group);
+      }
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsAggregateTest, AllFunctions) {
+  const auto aggregates = std::vector<AggregateDefinition>{{ColumnID{2}, AggregateFunction::Count},
+                                                           {ColumnID{2}, AggregateFunction::Sum},
+                                                           {ColumnID{2}, AggregateFunction::Min},
+                                                           {ColumnID{0}, AggregateFunction::Max},
+                                                           {ColumnID{3}, AggregateFunction::Avg}};
+  auto aggregate = std::make_shared<Aggregate>(_table_wrapper, aggregates, std::vector<ColumnID>{ColumnID{1}});
+  aggregate->execute();
+
+  const auto output = aggregate->get_output();
+  EXPECT_EQ(output->column_names(),
+            (std::vector<std::string>{"year", "COUNT(revenue)", "SUM(revenue)", "MIN(revenue)", "MAX(region)",
+                                      "AVG(margin)"}));
+  EXPECT_EQ(output->column_type(ColumnID{1}), "long");
+  EXPECT_EQ(output->column_type(ColumnID{2}), "long");
+  EXPECT_EQ(output->column_type(ColumnID{3}), "long");
+  EXPECT_EQ(output->column_type(ColumnID{4}), "string");
+  EXPECT_EQ(output->column_type(ColumnID{5}), "double");
+
+  const auto expected = std::vector<std::vector<AllTypeVariant>>{
+      {2016, int64_t{3}, int64_t{13}, int64_t{1}, "EU", 0.5},
+      {2017, int64_t{4}, int64_t{100}, int64_t{10}, "US", 0.5625},
+  };
+  EXPECT_EQ(_rows(output), expected);
+}
+
+TEST_F(OperatorsAggregateTest, MultipleGroupByColumns) {
+  const auto aggregates = std::vector<AggregateDefinition>{{ColumnID{2}, AggregateFunction::Sum}};
+  auto aggregate =
+      std::make_shared<Aggregate>(_table_wrapper, aggregates, std::vector<ColumnID>{ColumnID{0}, ColumnID{1}});
+  aggregate->execute();
+
+  const auto expected = std::vector<std::vector<AllTypeVariant>>{
+      {"APAC", 2016, int64_t{7}}, {"EU", 2016, int64_t{6}}, {"EU", 2017, int64_t{40}}, {"US", 2017, int64_t{60}}};
+  EXPECT_EQ(_rows(aggregate->get_output()), expected);
+}
+
+TEST_F(OperatorsAggregateTest, NoGroupByColumns) {
+  const auto aggregates = std::vector<AggregateDefinition>{{ColumnID{3}, AggregateFunction::Sum},
+                                                           {ColumnID{1}, AggregateFunction::Min}};
+  auto aggregate = std::make_shared<Aggregate>(_table_wrapper, aggregates, std::vector<ColumnID>{});
+  aggregate->execute();
+
+  const auto expected = std::vector<std::vector<AllTypeVariant>>{{3.75, 2016}};
+  EXPECT_EQ(_rows(aggregate->get_output()), expected);
+}
+
+TEST_F(OperatorsAggregateTest, ManyGroups) { _test_many_groups(); }
+
+TEST_F(OperatorsAggregateTest, ManyGroupsWithScheduler) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+  _test_many_groups();
+}
+
+TEST_F(OperatorsAggregateTest, CompressedAndReferenceInput) {
+  _table->compress_chunk(ChunkID{0});
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{2}, ScanType::OpGreaterThan, int64_t{5});
+  scan->execute();
+
+  const auto aggregates = std::vector<AggregateDefinition>{{ColumnID{2}, AggregateFunction::Max}};
+  auto aggregate = std::make_shared<Aggregate>(scan, aggregates, std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  const auto expected =
+      std::vector<std::vector<AllTypeVariant>>{{"APAC", int64_t{7}}, {"EU", int64_t{30}}, {"US", int64_t{40}}};
+  EXPECT_EQ(_rows(aggregate->get_output()), expected);
+}
+
+TEST_F(OperatorsAggregateTest, SumOfStrings) {
+  const auto aggregates = std::vector<AggregateDefinition>{{ColumnID{0}, AggregateFunction::Sum}};
+  auto aggregate = std::make_shared<Aggregate>(_table_wrapper, aggregates, std::vector<ColumnID>{});
+  EXPECT_THROW(aggregate->execute(), std::exception);
+}
+
+TEST_F(OperatorsAggregateTest, NullsInGroupByColumns) {
+  auto right = std::make_shared<Table>();
+  right->add_column("a", "int");
+  right->append({2017});
+  auto right_wrapper = std::make_shared<TableWrapper>(right);
+  right_wrapper->execute();
+
+  // the rows of 2016 have no partner, so their column a is NULL
+  auto join = std::make_shared<JoinHash>(_table_wrapper, right_wrapper, JoinMode::Left,
+                                         std::make_pair(ColumnID{1}, ColumnID{0}));
+  join->execute();
+
+  const auto aggregates = std::vector<AggregateDefinition>{{ColumnID{2}, AggregateFunction::Sum}};
+  auto aggregate = std::make_shared<Aggregate>(join, aggregates, std::vector<ColumnID>{ColumnID{4}, ColumnID{0}});
+  EXPECT_THROW(aggregate->execute(), std::logic_error);
+
+  auto single_column_aggregate = std::make_shared<Aggregate>(join, aggregates, std::vector<ColumnID>{ColumnID{4}});
+  EXPECT_THROW(single_column_aggregate->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsAggregateTest, GroupsWithOnlyNulls) {
+  auto right = std::make_shared<Table>();
+  right->add_column("a", "int");
+  right->append({2017});
+  auto right_wrapper = std::make_shared<TableWrapper>(right);
+  right_wrapper->execute();
+
+  // APAC only has a row of 2016, which has no partner, so column a of its group is all NULL
+  auto join = std::make_shared<JoinHash>(_table_wrapper, right_wrapper, JoinMode::Left,
+                                         std::make_pair(ColumnID{1}, ColumnID{0}));
+  join->execute();
+
+  const auto aggregates = std::vector<AggregateDefinition>{{ColumnID{4}, AggregateFunction::Count},
+                                                           {ColumnID{4}, AggregateFunction::Sum}};
+  auto aggregate = std::make_shared<Aggregate>(join, aggregates, std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+  const auto expected = std::vector<std::vector<AllTypeVariant>>{
+      {"APAC", int64_t{0}, int64_t{0}}, {"EU", int64_t{2}, int64_t{4034}}, {"US", int64_t{2}, int64_t{4034}}};
+  EXPECT_EQ(_rows(aggregate->get_output()), expected);
+
+  for (const auto function : {AggregateFunction::Min, AggregateFunction::Max, AggregateFunction::Avg}) {
+    const auto null_aggregates = std::vector<AggregateDefinition>{{ColumnID{4}, function}};
+    auto null_aggregate = std::make_shared<Aggregate>(join, null_aggregates, std::vector<ColumnID>{ColumnID{0}});
+    EXPECT_THROW(null_aggregate->execute(), std::logic_error);
+  }
+}
+
+}  // namespace opossum
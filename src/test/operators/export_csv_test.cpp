@@ -0,0 +1,128 @@
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/csv_format.hpp"
+#include "../lib/operators/export_csv.hpp"
+#include "../lib/operators/import_csv.hpp"
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/sort.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class OperatorsExportCsvTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _filename = ::testing::TempDir() + "opossum_export_csv_test.csv";
+
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "long");
+    _table->add_column("c", "float");
+    _table->add_column("d", "double");
+    _table->add_column("e", "string");
+    _table->append({1, int64_t{1} << 40, 0.5f, -0.25, "plain"});
+    _table->append({-2, int64_t{3}, 0.1f, 1e300, "a,b"});
+    _table->append({3, int64_t{-4}, 0.0f, 0.1, "say \"hi\"\nbye"});
+    _table->append({4, int64_t{5}, 2.5f, 3.0, ""});
+  }
+
+  std::shared_ptr<const Table> _export(const std::shared_ptr<const AbstractOperator>& in) {
+    auto export_csv = std::make_shared<ExportCsv>(in, _filename);
+    export_csv->execute();
+    EXPECT_EQ(export_csv->get_output(), in->get_output());
+
+    auto import_csv = std::make_shared<ImportCsv>(_filename);
+    import_csv->execute();
+    return import_csv->get_output();
+  }
+
+  std::shared_ptr<const AbstractOperator> _wrap(const std::shared_ptr<const Table>& table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::string _file_content() const {
+    std::ifstream stream(_filename);
+    std::stringstream content;
+    content << stream.rdbuf();
+    return content.str();
+  }
+
+  std::string _filename;
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsExportCsvTest, FileContent) {
+  _export(_wrap(_table));
+  EXPECT_EQ(_file_content(),
+            "1,1099511627776,0.5,-0.25,plain\n"
+            "-2,3,0.1,1e+300,\"a,b\"\n"
+            "3,-4,0,0.1,\"say \"\"hi\"\"\nbye\"\n"
+            "4,5,2.5,3,\n");
+
+  const auto meta = read_csv_meta(_filename);
+  EXPECT_EQ(meta.chunk_size, 2u);
+  EXPECT_EQ(meta.column_names, _table->column_names());
+  EXPECT_EQ(meta.column_types, (std::vector<std::string>{"int", "long", "float", "double", "string"}));
+}
+
+TEST_F(OperatorsExportCsvTest, RoundTrip) {
+  _table->compress_chunk(ChunkID{0});
+  const auto imported = _export(_wrap(_table));
+  EXPECT_TABLE_EQ(imported, _table, true);
+  EXPECT_EQ(imported->chunk_size(), 2u);
+}
+
+TEST_F(OperatorsExportCsvTest, ReferenceColumns) {
+  _table->compress_chunk(ChunkID{1});
+  auto sort = std::make_shared<Sort>(_wrap(_table), std::vector<SortColumnDefinition>{{ColumnID{4}}});
+  sort->execute();
+
+  EXPECT_TABLE_EQ(_export(sort), sort->get_output(), true);
+}
+
+TEST_F(OperatorsExportCsvTest, NullsAreNotSupported) {
+  auto right = std::make_shared<Table>();
+  right->add_column("a", "int");
+  right->add_column("f", "string");
+  right->append({1, "one"});
+
+  auto join = std::make_shared<JoinHash>(_wrap(_table), _wrap(right), JoinMode::Left,
+                                         std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+  auto export_csv = std::make_shared<ExportCsv>(join, _filename);
+  EXPECT_THROW(export_csv->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsExportCsvTest, ManyRows) {
+  // more text than the buffer holds
+  const auto row_count = 100000;
+  auto table = std::make_shared<Table>(30000);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  std::vector<int32_t> a(row_count);
+  std::vector<std::string> b(row_count);
+  for (auto row = 0; row < row_count; ++row) {
+    a[row] = row;
+    b[row] = std::string(row % 40, 'x') + (row % 3 == 0 ? "," : "");
+  }
+  table->append_column_batch(
+      {std::make_shared<ValueColumn<int32_t>>(std::move(a)), std::make_shared<ValueColumn<std::string>>(std::move(b))});
+
+  const auto imported = _export(_wrap(table));
+  EXPECT_EQ(imported->chunk_count(), 5u);
+  EXPECT_TABLE_EQ(imported, table, true);
+}
+
+}  // namespace opossum
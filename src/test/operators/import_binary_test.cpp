@@ -0,0 +1,180 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/export_binary.hpp"
+#include "../lib/operators/import_binary.hpp"
+#include "../lib/operators/sort.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/statistics/table_statistics.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class OperatorsImportBinaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _filename = ::testing::TempDir() + "opossum_import_binary_test.bin";
+
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int");
+    _table->add_column("b", "long");
+    _table->add_column("c", "float");
+    _table->add_column("d", "double");
+    _table->add_column("e", "string");
+    for (auto row = 0; row < 10; ++row) {
+      _table->append({row % 3, int64_t{row} << 40, row * 0.5f, row * -0.25, std::string(row % 4, 'x') + "y"});
+    }
+  }
+
+  void TearDown() override { StorageManager::reset(); }
+
+  std::shared_ptr<const Table> _export_and_import(const std::shared_ptr<const Table>& table,
+                                                  const BinaryImportMode mode = BinaryImportMode::Read) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    auto export_binary = std::make_shared<ExportBinary>(table_wrapper, _filename);
+    export_binary->execute();
+    EXPECT_EQ(export_binary->get_output(), table);
+
+    auto import_binary = std::make_shared<ImportBinary>(_filename, std::nullopt, mode);
+    import_binary->execute();
+    return import_binary->get_output();
+  }
+
+  std::string _filename;
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsImportBinaryTest, ValueColumns) {
+  const auto imported = _export_and_import(_table);
+  EXPECT_TABLE_EQ(imported, _table, true);
+  EXPECT_EQ(imported->chunk_size(), 4u);
+  EXPECT_EQ(imported->column_names(), _table->column_names());
+  EXPECT_EQ(imported->column_type(ColumnID{1}), "long");
+}
+
+TEST_F(OperatorsImportBinaryTest, DictionaryColumnsAreKept) {
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1});
+
+  const auto imported = _export_and_import(_table);
+  EXPECT_TABLE_EQ(imported, _table, true);
+
+  const auto& column = *imported->get_chunk(ChunkID{0}).get_column(ColumnID{4});
+  const auto& dictionary_column = dynamic_cast<const DictionaryColumn<std::string>&>(column);
+  EXPECT_EQ(dictionary_column.unique_values_count(), 4u);
+  // four distinct values only need a two-bit attribute vector
+  EXPECT_EQ(dictionary_column.attribute_vector()->width(), 2u);
+  EXPECT_NE(dynamic_cast<const ValueColumn<int32_t>*>(imported->get_chunk(ChunkID{2}).get_column(ColumnID{0}).get()),
+            nullptr);
+}
+
+TEST_F(OperatorsImportBinaryTest, ImportedChunksAreSealed) {
+  const auto imported = std::const_pointer_cast<Table>(_export_and_import(_table));
+  EXPECT_TRUE(imported->get_chunk(ChunkID{2}).is_sealed());
+  EXPECT_EQ(imported->table_statistics()->row_count(), 10u);
+
+  // appended rows go into a new chunk
+  imported->append({1, int64_t{2}, 3.0f, 4.0, "z"});
+  EXPECT_EQ(imported->get_chunk(ChunkID{2}).size(), 2u);
+  EXPECT_EQ(imported->row_count(), 11u);
+}
+
+TEST_F(OperatorsImportBinaryTest, MemoryMapped) {
+  _table->compress_chunk(ChunkID{0});
+
+  const auto imported = std::const_pointer_cast<Table>(_export_and_import(_table, BinaryImportMode::MemoryMap));
+  // the mapping stays valid without the file
+  std::remove(_filename.c_str());
+  EXPECT_TABLE_EQ(imported, _table, true);
+
+  // fixed-width values are used in place, strings and dictionary columns are copied
+  const auto& chunk = imported->get_chunk(ChunkID{1});
+  const auto long_column = std::dynamic_pointer_cast<const ValueColumn<int64_t>>(chunk.get_column(ColumnID{1}));
+  ASSERT_NE(long_column, nullptr);
+  EXPECT_FALSE(long_column->owns_values());
+  EXPECT_EQ(long_column->get_typed(2), int64_t{6} << 40);
+  EXPECT_THROW(long_column->values(), std::exception);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const ValueColumn<std::string>>(chunk.get_column(ColumnID{4}))->owns_values());
+  EXPECT_NE(std::dynamic_pointer_cast<const DictionaryColumn<int32_t>>(
+                imported->get_chunk(ChunkID{0}).get_column(ColumnID{0})),
+            nullptr);
+
+  // mapped chunks are not sealed, but can be compressed, and appended rows go into a new chunk
+  EXPECT_FALSE(chunk.is_sealed());
+  imported->compress_chunk(ChunkID{1});
+  imported->append({1, int64_t{2}, 3.0f, 4.0, "z"});
+  EXPECT_EQ(imported->get_chunk(ChunkID{3}).size(), 1u);
+  EXPECT_EQ(imported->row_count(), 11u);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(imported);
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{2}, ScanType::OpGreaterThan, 3.0f);
+  table_scan->execute();
+  EXPECT_EQ(table_scan->get_output()->row_count(), 3u);
+}
+
+TEST_F(OperatorsImportBinaryTest, ReferenceColumns) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 1);
+  table_scan->execute();
+
+  const auto imported = _export_and_import(table_scan->get_output());
+  EXPECT_TABLE_EQ(imported, table_scan->get_output(), true);
+  EXPECT_EQ(imported->row_count(), 3u);
+}
+
+TEST_F(OperatorsImportBinaryTest, SortedReferenceColumns) {
+  // a single chunk of ReferenceColumns into all chunks, with the strings out of order
+  _table->compress_chunk(ChunkID{1});
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto sort = std::make_shared<Sort>(table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{4}}});
+  sort->execute();
+
+  const auto imported = _export_and_import(sort->get_output());
+  EXPECT_TABLE_EQ(imported, sort->get_output(), true);
+  EXPECT_EQ(imported->get_chunk(ChunkID{0}).size(), 10u);
+}
+
+TEST_F(OperatorsImportBinaryTest, EmptyTable) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+
+  const auto imported = _export_and_import(table);
+  EXPECT_EQ(imported->row_count(), 0u);
+  EXPECT_EQ(imported->col_count(), 2u);
+  EXPECT_EQ(imported->column_name(ColumnID{1}), "b");
+}
+
+TEST_F(OperatorsImportBinaryTest, TableName) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  std::make_shared<ExportBinary>(table_wrapper, _filename)->execute();
+
+  auto import_binary = std::make_shared<ImportBinary>(_filename, "table_a");
+  import_binary->execute();
+  EXPECT_EQ(StorageManager::get().get_table("table_a"), import_binary->get_output());
+
+  // the table is not loaded again
+  auto second_import = std::make_shared<ImportBinary>("does_not_exist.bin", "table_a");
+  second_import->execute();
+  EXPECT_EQ(second_import->get_output(), import_binary->get_output());
+}
+
+TEST_F(OperatorsImportBinaryTest, InvalidFile) {
+  EXPECT_THROW(std::make_shared<ImportBinary>("does_not_exist.bin")->execute(), std::exception);
+}
+
+}  // namespace opossum
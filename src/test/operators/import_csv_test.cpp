@@ -0,0 +1,221 @@
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/csv_format.hpp"
+#include "../lib/operators/import_csv.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/statistics/table_statistics.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class OperatorsImportCsvTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _filename = ::testing::TempDir() + "opossum_import_csv_test.csv";
+
+    _meta.chunk_size = 2;
+    _meta.column_names = {"a", "b", "c", "d", "e"};
+    _meta.column_types = {"int", "long", "float", "double", "string"};
+  }
+
+  void TearDown() override { StorageManager::reset(); }
+
+  void _write_csv(const std::string& content) {
+    std::ofstream stream(_filename, std::ios::binary);
+    stream << content;
+    write_csv_meta(_filename, _meta);
+  }
+
+  // imports a large file with and without a chunk size
+  void _test_many_rows() {
+    // long string fields make the SIMD scans cover full blocks, and the quoted ones contain line breaks
+    const auto row_count = 100000;
+    std::string content;
+    auto expected_unlimited = _expected_table(0);
+    for (auto row = 0; row < row_count; ++row) {
+      const auto text = std::string(row % 50, 'a' + row % 26) + (row % 7 == 0 ? "\n," : "");
+      content += std::to_string(row) + "," + std::to_string(int64_t{row} * 3) + "," + std::to_string(row % 10) + ".5," +
+                 std::to_string(row) + ".25,";
+      content += row % 7 == 0 ? "\"" + text + "\"\n" : text + "\n";
+      expected_unlimited->append({row, int64_t{row} * 3, row % 10 + 0.5f, row + 0.25, text});
+    }
+
+    _meta.chunk_size = 1000;
+    _write_csv(content);
+    const auto table = _import();
+    EXPECT_EQ(table->chunk_count(), 101u);
+    EXPECT_EQ(table->get_chunk(ChunkID{99}).size(), 1000u);
+    EXPECT_TABLE_EQ(table, expected_unlimited, true);
+
+    // tables with unlimited chunks are parsed in several ranges, too, which are combined into one chunk
+    _meta.chunk_size = 0;
+    _write_csv(content);
+    const auto unlimited = _import();
+    EXPECT_EQ(unlimited->get_chunk(ChunkID{0}).size(), static_cast<uint32_t>(row_count));
+    EXPECT_TABLE_EQ(unlimited, expected_unlimited, true);
+
+    // the zone maps and statistics of the ranges are combined
+    const auto& zone_map = unlimited->get_chunk(ChunkID{0}).zone_map(ColumnID{0});
+    ASSERT_TRUE(zone_map);
+    EXPECT_EQ(zone_map->min, AllTypeVariant{0});
+    EXPECT_EQ(zone_map->max, AllTypeVariant{row_count - 1});
+    EXPECT_EQ(unlimited->table_statistics()->row_count(), static_cast<uint64_t>(row_count));
+    EXPECT_NEAR(unlimited->table_statistics()->estimate_cardinality(ColumnID{0}, ScanType::OpLessThan, 1000), 1000.0,
+                100.0);
+  }
+
+  std::shared_ptr<const Table> _import() {
+    auto import_csv = std::make_shared<ImportCsv>(_filename);
+    import_csv->execute();
+    return import_csv->get_output();
+  }
+
+  std::shared_ptr<Table> _expected_table(const uint32_t chunk_size) {
+    auto table = std::make_shared<Table>(chunk_size);
+    for (size_t column_index = 0; column_index < _meta.column_names.size(); ++column_index) {
+      table->add_column(_meta.column_names[column_index], _meta.column_types[column_index]);
+    }
+    return table;
+  }
+
+  std::string _filename;
+  CsvMeta _meta;
+};
+
+TEST_F(OperatorsImportCsvTest, Meta) {
+  _write_csv("");
+  const auto meta = read_csv_meta(_filename);
+  EXPECT_EQ(meta.chunk_size, 2u);
+  EXPECT_EQ(meta.column_names, _meta.column_names);
+  EXPECT_EQ(meta.column_types, _meta.column_types);
+}
+
+TEST_F(OperatorsImportCsvTest, Types) {
+  _write_csv("1,1099511627776,0.5,-0.25,y\n-2,3,1e3,2.5e-3,hello world\n3,-4,0,0,\n");
+
+  auto expected = _expected_table(2);
+  expected->append({1, int64_t{1} << 40, 0.5f, -0.25, "y"});
+  expected->append({-2, int64_t{3}, 1000.0f, 0.0025, "hello world"});
+  expected->append({3, int64_t{-4}, 0.0f, 0.0, ""});
+
+  const auto table = _import();
+  EXPECT_TABLE_EQ(table, expected, true);
+  EXPECT_EQ(table->chunk_size(), 2u);
+  // two full chunks and the chunk for further rows
+  EXPECT_EQ(table->chunk_count(), 3u);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0}).is_sealed());
+  EXPECT_NE(dynamic_cast<const ValueColumn<int64_t>*>(table->get_chunk(ChunkID{0}).get_column(ColumnID{1}).get()),
+            nullptr);
+}
+
+TEST_F(OperatorsImportCsvTest, QuotedFields) {
+  _write_csv(
+      "1,2,3,4,\"a,b\"\n"
+      "5,6,7,8,\"multi\nline\"\n"
+      "9,10,11,12,\"say \"\"hi\"\"\"\n"
+      "\"13\",14,15,16,\"\"\n");
+
+  auto expected = _expected_table(2);
+  expected->append({1, int64_t{2}, 3.0f, 4.0, "a,b"});
+  expected->append({5, int64_t{6}, 7.0f, 8.0, "multi\nline"});
+  expected->append({9, int64_t{10}, 11.0f, 12.0, "say \"hi\""});
+  expected->append({13, int64_t{14}, 15.0f, 16.0, ""});
+
+  EXPECT_TABLE_EQ(_import(), expected, true);
+}
+
+TEST_F(OperatorsImportCsvTest, LineBreaks) {
+  // \r\n line breaks and no line break after the last row
+  _write_csv("1,2,3,4,x\r\n5,6,7,8,\"y\"\r\n9,10,11,12,z");
+
+  auto expected = _expected_table(2);
+  expected->append({1, int64_t{2}, 3.0f, 4.0, "x"});
+  expected->append({5, int64_t{6}, 7.0f, 8.0, "y"});
+  expected->append({9, int64_t{10}, 11.0f, 12.0, "z"});
+
+  EXPECT_TABLE_EQ(_import(), expected, true);
+}
+
+TEST_F(OperatorsImportCsvTest, EmptyFile) {
+  _write_csv("");
+  const auto table = _import();
+  EXPECT_EQ(table->row_count(), 0u);
+  EXPECT_EQ(table->col_count(), 5u);
+}
+
+TEST_F(OperatorsImportCsvTest, ManyRows) { _test_many_rows(); }
+
+TEST_F(OperatorsImportCsvTest, ManyRowsWithScheduler) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+  _test_many_rows();
+
+  // the exceptions of the parse jobs reach the caller
+  _meta.chunk_size = 1;
+  _write_csv("1,2,3,4,x\nfive,6,7,8,y\n");
+  EXPECT_THROW(_import(), std::exception);
+}
+
+TEST_F(OperatorsImportCsvTest, TableDefinition) {
+  {
+    std::ofstream stream(_filename);
+    stream << "1,x\n2,y\n3,z\n";
+  }
+
+  auto definition = std::make_shared<Table>(2);
+  definition->add_column_definition("id", "int");
+  definition->add_column_definition("name", "string");
+
+  auto import_csv = std::make_shared<ImportCsv>(_filename, definition, "names");
+  import_csv->execute();
+
+  auto expected = std::make_shared<Table>(2);
+  expected->add_column("id", "int");
+  expected->add_column("name", "string");
+  expected->append({1, "x"});
+  expected->append({2, "y"});
+  expected->append({3, "z"});
+  EXPECT_TABLE_EQ(import_csv->get_output(), expected, true);
+  EXPECT_EQ(StorageManager::get().get_table("names"), import_csv->get_output());
+
+  // the table is taken from the StorageManager
+  auto import_again = std::make_shared<ImportCsv>(_filename, definition, "names");
+  import_again->execute();
+  EXPECT_EQ(import_again->get_output(), import_csv->get_output());
+}
+
+TEST_F(OperatorsImportCsvTest, InvalidInput) {
+  _write_csv("1,2,3,4,x\nfive,6,7,8,y\n");
+  EXPECT_THROW(_import(), std::exception);
+
+  _write_csv("1,2,3.5x,4,x\n");
+  EXPECT_THROW(_import(), std::exception);
+
+  _write_csv("1,2,3,,x\n");
+  EXPECT_THROW(_import(), std::exception);
+
+  _write_csv("1,2,3,1e999,x\n");
+  EXPECT_THROW(_import(), std::exception);
+
+  _write_csv("1,2,3,4\n");
+  EXPECT_THROW(_import(), std::exception);
+
+  _write_csv("1,2,3,4,x,y\n");
+  EXPECT_THROW(_import(), std::exception);
+
+  _write_csv("1,2,3,4,\"x\n");
+  EXPECT_THROW(_import(), std::exception);
+
+  auto import_csv = std::make_shared<ImportCsv>(_filename + ".missing");
+  EXPECT_THROW(import_csv->execute(), std::exception);
+}
+
+}  // namespace opossum
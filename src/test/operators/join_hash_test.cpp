@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _left = std::make_shared<Table>(2);
+    _left->add_column("a", "int");
+    _left->add_column("b", "string");
+    _left->append({1, "one"});
+    _left->append({2, "two"});
+    _left->append({2, "two again"});
+    _left->append({4, "four"});
+
+    _right = std::make_shared<Table>(3);
+    _right->add_column("c", "long");
+    _right->add_column("d", "string");
+    _right->append({int64_t{2}, "two"});
+    _right->append({int64_t{3}, "three"});
+    _right->append({int64_t{2}, "two"});
+    _right->append({int64_t{1}, "one"});
+
+    _left_wrapper = std::make_shared<TableWrapper>(_left);
+    _left_wrapper->execute();
+    _right_wrapper = std::make_shared<TableWrapper>(_right);
+    _right_wrapper->execute();
+  }
+
+  // returns the joined rows as sorted pairs of row numbers of the left and the right input (-1 for NULL_ROW_ID)
+  // for Semi and Anti joins, both row numbers are taken from the left input
+  static std::vector<std::pair<int, int>> _rows(const std::shared_ptr<const Table>& table, const ColumnID left_column,
+                                                const ColumnID right_column, const uint32_t right_chunk_size = 3) {
+    const auto& chunk = table->get_chunk(ChunkID{0});
+    const auto row_numbers = [&](const ColumnID column_id, const uint32_t chunk_size) {
+      const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(column_id));
+      std::vector<int> rows;
+      for (const auto& row_id : *reference_column->pos_list()) {
+        const auto row = row_id.chunk_id * chunk_size + row_id.chunk_offset;
+        rows.push_back(row_id == NULL_ROW_ID ? -1 : static_cast<int>(row));
+      }
+      return rows;
+    };
+
+    const auto left_rows = row_numbers(left_column, 2);
+    const auto right_rows = row_numbers(right_column, right_chunk_size);
+    std::vector<std::pair<int, int>> rows;
+    for (size_t row = 0; row < left_rows.size(); ++row) rows.emplace_back(left_rows[row], right_rows[row]);
+    std::sort(rows.begin(), rows.end());
+    return rows;
+  }
+
+  std::vector<std::pair<int, int>> _join(const JoinMode mode, const std::pair<ColumnID, ColumnID>& column_ids) {
+    auto join = std::make_shared<JoinHash>(_left_wrapper, _right_wrapper, mode, column_ids);
+    join->execute();
+
+    const auto output = join->get_output();
+    if (mode == JoinMode::Semi || mode == JoinMode::Anti) {
+      EXPECT_EQ(output->col_count(), 2u);
+      return _rows(output, ColumnID{0}, ColumnID{0}, 2);
+    }
+
+    EXPECT_EQ(output->col_count(), 4u);
+    return _rows(output, ColumnID{0}, ColumnID{2});
+  }
+
+  // joins tables that are large enough for the radix partitioning to use several partitions
+  void _test_many_partitions() {
+    auto left = std::make_shared<Table>(1000);
+    left->add_column("a", "int");
+    auto right = std::make_shared<Table>(1000);
+    right->add_column("b", "int");
+    for (auto i = 0; i < 50000; ++i) {
+      left->append({i});
+      if (i % 2 == 0) right->append({i});
+    }
+
+    auto left_wrapper = std::make_shared<TableWrapper>(left);
+    left_wrapper->execute();
+    auto right_wrapper = std::make_shared<TableWrapper>(right);
+    right_wrapper->execute();
+
+    auto inner = std::make_shared<JoinHash>(left_wrapper, right_wrapper, JoinMode::Inner,
+                                            std::make_pair(ColumnID{0}, ColumnID{0}));
+    inner->execute();
+    EXPECT_EQ(inner->get_output()->row_count(), 25000u);
+
+    auto anti = std::make_shared<JoinHash>(left_wrapper, right_wrapper, JoinMode::Anti,
+                                           std::make_pair(ColumnID{0}, ColumnID{0}));
+    anti->execute();
+    EXPECT_EQ(anti->get_output()->row_count(), 25000u);
+  }
+
+  std::shared_ptr<Table> _left;
+  std::shared_ptr<Table> _right;
+  std::shared_ptr<TableWrapper> _left_wrapper;
+  std::shared_ptr<TableWrapper> _right_wrapper;
+};
+
+TEST_F(OperatorsJoinHashTest, InnerMixedIntegerTypes) {
+  const auto expected = std::vector<std::pair<int, int>>{{0, 3}, {1, 0}, {1, 2}, {2, 0}, {2, 2}};
+  EXPECT_EQ(_join(JoinMode::Inner, {ColumnID{0}, ColumnID{0}}), expected);
+}
+
+TEST_F(OperatorsJoinHashTest, InnerStrings) {
+  const auto expected = std::vector<std::pair<int, int>>{{0, 3}, {1, 0}, {1, 2}};
+  EXPECT_EQ(_join(JoinMode::Inner, {ColumnID{1}, ColumnID{1}}), expected);
+}
+
+TEST_F(OperatorsJoinHashTest, Left) {
+  const auto expected = std::vector<std::pair<int, int>>{{0, 3}, {1, 0}, {1, 2}, {2, 0}, {2, 2}, {3, -1}};
+  EXPECT_EQ(_join(JoinMode::Left, {ColumnID{0}, ColumnID{0}}), expected);
+}
+
+TEST_F(OperatorsJoinHashTest, Right) {
+  const auto expected = std::vector<std::pair<int, int>>{{-1, 1}, {0, 3}, {1, 0}, {1, 2}, {2, 0}, {2, 2}};
+  EXPECT_EQ(_join(JoinMode::Right, {ColumnID{0}, ColumnID{0}}), expected);
+}
+
+TEST_F(OperatorsJoinHashTest, Outer) {
+  const auto expected = std::vector<std::pair<int, int>>{{-1, 1}, {0, 3}, {1, 0}, {1, 2}, {2, 0}, {2, 2}, {3, -1}};
+  EXPECT_EQ(_join(JoinMode::Outer, {ColumnID{0}, ColumnID{0}}), expected);
+}
+
+TEST_F(OperatorsJoinHashTest, Semi) {
+  const auto expected = std::vector<std::pair<int, int>>{{0, 0}, {1, 1}, {2, 2}};
+  EXPECT_EQ(_join(JoinMode::Semi, {ColumnID{0}, ColumnID{0}}), expected);
+}
+
+TEST_F(OperatorsJoinHashTest, Anti) {
+  const auto expected = std::vector<std::pair<int, int>>{{3, 3}};
+  EXPECT_EQ(_join(JoinMode::Anti, {ColumnID{0}, ColumnID{0}}), expected);
+}
+
+TEST_F(OperatorsJoinHashTest, CompressedAndReferenceInputs) {
+  _left->compress_chunk(ChunkID{0});
+
+  // the scan removes the right row with the value 3
+  auto scan = std::make_shared<TableScan>(_right_wrapper, ColumnID{0}, ScanType::OpNotEquals, int64_t{3});
+  scan->execute();
+  auto join =
+      std::make_shared<JoinHash>(_left_wrapper, scan, JoinMode::Outer, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  // the right positions refer to the table of the scan, not to its output
+  const auto expected = std::vector<std::pair<int, int>>{{0, 3}, {1, 0}, {1, 2}, {2, 0}, {2, 2}, {3, -1}};
+  EXPECT_EQ(_rows(join->get_output(), ColumnID{0}, ColumnID{2}), expected);
+}
+
+TEST_F(OperatorsJoinHashTest, ManyPartitions) { _test_many_partitions(); }
+
+TEST_F(OperatorsJoinHashTest, ManyPartitionsWithScheduler) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+  _test_many_partitions();
+}
+
+TEST_F(OperatorsJoinHashTest, NullKeysOfChainedOuterJoins) {
+  auto left = std::make_shared<Table>();
+  left->add_column("a", "int");
+  left->append({1});
+  left->append({2});
+  auto right = std::make_shared<Table>();
+  right->add_column("b", "int");
+  right->append({1});
+
+  auto left_wrapper = std::make_shared<TableWrapper>(left);
+  left_wrapper->execute();
+  auto right_wrapper = std::make_shared<TableWrapper>(right);
+  right_wrapper->execute();
+
+  // (1, 1) and (2, NULL)
+  auto first_join =
+      std::make_shared<JoinHash>(left_wrapper, right_wrapper, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  first_join->execute();
+  ASSERT_EQ(first_join->get_output()->row_count(), 2u);
+
+  // the row with the NULL in b has no partner, but is kept by the preserving joins
+  const auto join_on_b = [&](const JoinMode mode) {
+    auto join = std::make_shared<JoinHash>(first_join, right_wrapper, mode, std::make_pair(ColumnID{1}, ColumnID{0}));
+    join->execute();
+    return join->get_output()->row_count();
+  };
+  EXPECT_EQ(join_on_b(JoinMode::Left), 2u);
+  EXPECT_EQ(join_on_b(JoinMode::Outer), 2u);
+  EXPECT_EQ(join_on_b(JoinMode::Inner), 1u);
+  EXPECT_EQ(join_on_b(JoinMode::Right), 1u);
+  EXPECT_EQ(join_on_b(JoinMode::Semi), 1u);
+  EXPECT_EQ(join_on_b(JoinMode::Anti), 1u);
+
+  // NULL keys of the right input are kept by Right and Outer joins
+  auto reversed = std::make_shared<JoinHash>(right_wrapper, first_join, JoinMode::Right,
+                                             std::make_pair(ColumnID{0}, ColumnID{1}));
+  reversed->execute();
+  EXPECT_EQ(reversed->get_output()->row_count(), 2u);
+}
+
+TEST_F(OperatorsJoinHashTest, IncompatibleTypes) {
+  auto join = std::make_shared<JoinHash>(_left_wrapper, _right_wrapper, JoinMode::Inner,
+                                         std::make_pair(ColumnID{0}, ColumnID{1}));
+  EXPECT_THROW(join->execute(), std::exception);
+}
+
+}  // namespace opossum
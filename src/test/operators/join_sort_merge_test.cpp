@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_sort_merge.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class OperatorsJoinSortMergeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _left = std::make_shared<Table>(2);
+    _left->add_column("timestamp", "long");
+    _left->append({int64_t{30}});
+    _left->append({int64_t{10}});
+    _left->append({int64_t{20}});
+
+    _right = std::make_shared<Table>(2);
+    _right->add_column("start", "int");
+    _right->append({25});
+    _right->append({20});
+    _right->append({5});
+    _right->append({20});
+
+    _left_wrapper = std::make_shared<TableWrapper>(_left);
+    _left_wrapper->execute();
+    _right_wrapper = std::make_shared<TableWrapper>(_right);
+    _right_wrapper->execute();
+  }
+
+  // returns the joined rows as sorted pairs of row numbers of the left and the right input
+  std::vector<std::pair<int, int>> _join(const ScanType scan_type) {
+    auto join = std::make_shared<JoinSortMerge>(_left_wrapper, _right_wrapper, scan_type,
+                                                std::make_pair(ColumnID{0}, ColumnID{0}));
+    join->execute();
+
+    const auto& chunk = join->get_output()->get_chunk(ChunkID{0});
+    const auto& left_pos_list =
+        *std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{0}))->pos_list();
+    const auto& right_pos_list =
+        *std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{1}))->pos_list();
+
+    std::vector<std::pair<int, int>> rows;
+    for (size_t row = 0; row < left_pos_list.size(); ++row) {
+      rows.emplace_back(left_pos_list[row].chunk_id * 2 + left_pos_list[row].chunk_offset,
+                        right_pos_list[row].chunk_id * 2 + right_pos_list[row].chunk_offset);
+    }
+    std::sort(rows.begin(), rows.end());
+    return rows;
+  }
+
+  // joins tables that are large enough for the merge and the join to be split into several parts
+  void _test_many_chunks() {
+    const auto row_count = 150000;
+    auto left = std::make_shared<Table>(10000);
+    left->add_column("a", "int");
+    std::vector<int32_t> values(row_count);
+    for (auto i = 0; i < row_count; ++i) values[i] = row_count - 1 - i;
+    left->append_column_batch({std::make_shared<ValueColumn<int32_t>>(std::move(values))});
+
+    auto right = std::make_shared<Table>(10);
+    right->add_column("b", "int");
+    for (auto i = 0; i < 100; ++i) right->append({i * 1000});
+
+    auto left_wrapper = std::make_shared<TableWrapper>(left);
+    left_wrapper->execute();
+    auto right_wrapper = std::make_shared<TableWrapper>(right);
+    right_wrapper->execute();
+
+    auto equals = std::make_shared<JoinSortMerge>(left_wrapper, right_wrapper, ScanType::OpEquals,
+                                                  std::make_pair(ColumnID{0}, ColumnID{0}));
+    equals->execute();
+    EXPECT_EQ(equals->get_output()->row_count(), 100u);
+
+    // each right value b matches the left values 0 to b - 1
+    auto less_than = std::make_shared<JoinSortMerge>(left_wrapper, right_wrapper, ScanType::OpLessThan,
+                                                     std::make_pair(ColumnID{0}, ColumnID{0}));
+    less_than->execute();
+    EXPECT_EQ(less_than->get_output()->row_count(), 4950000u);
+
+    // the output is ordered by the left join column
+    const auto& chunk = less_than->get_output()->get_chunk(ChunkID{0});
+    const auto& pos_list = *std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{0}))->pos_list();
+    const auto value = [&](const RowID& row_id) {
+      return row_count - 1 - static_cast<int>(row_id.chunk_id * 10000 + row_id.chunk_offset);
+    };
+    for (size_t row = 1; row < pos_list.size(); ++row) {
+      ASSERT_LE(value(pos_list[row - 1]), value(pos_list[row]));
+    }
+  }
+
+  std::shared_ptr<Table> _left;
+  std::shared_ptr<Table> _right;
+  std::shared_ptr<TableWrapper> _left_wrapper;
+  std::shared_ptr<TableWrapper> _right_wrapper;
+};
+
+TEST_F(OperatorsJoinSortMergeTest, Equals) {
+  const auto expected = std::vector<std::pair<int, int>>{{2, 1}, {2, 3}};
+  EXPECT_EQ(_join(ScanType::OpEquals), expected);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, LessThan) {
+  const auto expected = std::vector<std::pair<int, int>>{{1, 0}, {1, 1}, {1, 3}, {2, 0}};
+  EXPECT_EQ(_join(ScanType::OpLessThan), expected);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, LessThanEquals) {
+  const auto expected = std::vector<std::pair<int, int>>{{1, 0}, {1, 1}, {1, 3}, {2, 0}, {2, 1}, {2, 3}};
+  EXPECT_EQ(_join(ScanType::OpLessThanEquals), expected);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, GreaterThan) {
+  const auto expected = std::vector<std::pair<int, int>>{{0, 0}, {0, 1}, {0, 2}, {0, 3}, {1, 2}, {2, 2}};
+  EXPECT_EQ(_join(ScanType::OpGreaterThan), expected);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, GreaterThanEquals) {
+  const auto expected =
+      std::vector<std::pair<int, int>>{{0, 0}, {0, 1}, {0, 2}, {0, 3}, {1, 2}, {2, 1}, {2, 2}, {2, 3}};
+  EXPECT_EQ(_join(ScanType::OpGreaterThanEquals), expected);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, CompressedInput) {
+  _right->compress_chunk(ChunkID{0});
+  const auto expected = std::vector<std::pair<int, int>>{{2, 1}, {2, 3}};
+  EXPECT_EQ(_join(ScanType::OpEquals), expected);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, UnsupportedScanType) {
+  EXPECT_THROW(JoinSortMerge(_left_wrapper, _right_wrapper, ScanType::OpNotEquals,
+                             std::make_pair(ColumnID{0}, ColumnID{0})),
+               std::exception);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, ManyChunks) { _test_many_chunks(); }
+
+TEST_F(OperatorsJoinSortMergeTest, ManyChunksWithScheduler) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+  _test_many_chunks();
+}
+
+}  // namespace opossum
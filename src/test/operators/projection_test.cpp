@@ -0,0 +1,175 @@
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/projection.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class OperatorsProjectionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "long");
+    _table->add_column("c", "float");
+    _table->add_column("d", "double");
+    _table->add_column("e", "string");
+    _table->append({1, int64_t{10}, 0.5f, 1.25, "one"});
+    _table->append({2, int64_t{20}, 1.5f, 2.25, "two"});
+    _table->append({3, int64_t{30}, 2.5f, 3.25, "three"});
+    _table->append({4, int64_t{40}, 3.5f, 4.25, "four"});
+    _table->append({5, int64_t{50}, 4.5f, 5.25, "five"});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<const Table> _project(const std::shared_ptr<ProjectionExpression>& expression,
+                                        const std::shared_ptr<const AbstractOperator>& in = nullptr) {
+    auto projection = std::make_shared<Projection>(in ? in : _table_wrapper,
+                                                   std::vector<ProjectionDefinition>{{expression, "result"}});
+    projection->execute();
+    return projection->get_output();
+  }
+
+  // returns the values of the first output column over all chunks
+  template <typename T>
+  static std::vector<T> _values(const std::shared_ptr<const Table>& table) {
+    std::vector<T> values;
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto column = table->get_chunk(chunk_id).get_column(ColumnID{0});
+      const auto& column_values = std::dynamic_pointer_cast<const ValueColumn<T>>(column)->values();
+      values.insert(values.end(), column_values.cbegin(), column_values.cend());
+    }
+    return values;
+  }
+
+  static std::shared_ptr<ProjectionExpression> _column(const ColumnID column_id) {
+    return ProjectionExpression::column(column_id);
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsProjectionTest, Arithmetic) {
+  const auto sum = _project(ProjectionExpression::arithmetic(ArithmeticOperator::Addition, _column(ColumnID{0}),
+                                                             _column(ColumnID{1})));
+  EXPECT_EQ(sum->column_type(ColumnID{0}), "long");
+  EXPECT_EQ(sum->column_name(ColumnID{0}), "result");
+  EXPECT_EQ(sum->chunk_count(), _table->chunk_count());
+  EXPECT_EQ(_values<int64_t>(sum), (std::vector<int64_t>{11, 22, 33, 44, 55}));
+
+  const auto difference = _project(ProjectionExpression::arithmetic(
+      ArithmeticOperator::Subtraction, _column(ColumnID{0}), ProjectionExpression::literal(10)));
+  EXPECT_EQ(difference->column_type(ColumnID{0}), "int");
+  EXPECT_EQ(_values<int32_t>(difference), (std::vector<int32_t>{-9, -8, -7, -6, -5}));
+
+  const auto product = _project(ProjectionExpression::arithmetic(ArithmeticOperator::Multiplication,
+                                                                 _column(ColumnID{2}), _column(ColumnID{3})));
+  EXPECT_EQ(product->column_type(ColumnID{0}), "double");
+  EXPECT_EQ(_values<double>(product), (std::vector<double>{0.625, 3.375, 8.125, 14.875, 23.625}));
+
+  const auto quotient = _project(ProjectionExpression::arithmetic(
+      ArithmeticOperator::Division, ProjectionExpression::literal(int64_t{100}), _column(ColumnID{0})));
+  EXPECT_EQ(quotient->column_type(ColumnID{0}), "long");
+  EXPECT_EQ(_values<int64_t>(quotient), (std::vector<int64_t>{100, 50, 33, 25, 20}));
+
+  const auto float_quotient = _project(ProjectionExpression::arithmetic(
+      ArithmeticOperator::Division, _column(ColumnID{2}), ProjectionExpression::literal(0.5f)));
+  EXPECT_EQ(float_quotient->column_type(ColumnID{0}), "float");
+  EXPECT_EQ(_values<float>(float_quotient), (std::vector<float>{1.0f, 3.0f, 5.0f, 7.0f, 9.0f}));
+}
+
+TEST_F(OperatorsProjectionTest, NestedExpressionsAndCasts) {
+  // (double) (a * b) / 4 + c
+  const auto expression = ProjectionExpression::arithmetic(
+      ArithmeticOperator::Addition,
+      ProjectionExpression::arithmetic(
+          ArithmeticOperator::Division,
+          ProjectionExpression::cast(
+              ProjectionExpression::arithmetic(ArithmeticOperator::Multiplication, _column(ColumnID{0}),
+                                               _column(ColumnID{1})),
+              "double"),
+          ProjectionExpression::literal(4)),
+      _column(ColumnID{2}));
+  const auto result = _project(expression);
+  EXPECT_EQ(result->column_type(ColumnID{0}), "double");
+  EXPECT_EQ(_values<double>(result), (std::vector<double>{3.0, 11.5, 25.0, 43.5, 67.0}));
+
+  const auto truncated = _project(ProjectionExpression::cast(_column(ColumnID{3}), "int"));
+  EXPECT_EQ(truncated->column_type(ColumnID{0}), "int");
+  EXPECT_EQ(_values<int32_t>(truncated), (std::vector<int32_t>{1, 2, 3, 4, 5}));
+}
+
+TEST_F(OperatorsProjectionTest, ColumnsAndLiterals) {
+  auto projection = std::make_shared<Projection>(
+      _table_wrapper,
+      std::vector<ProjectionDefinition>{{_column(ColumnID{4}), "e"}, {ProjectionExpression::literal(7.5), "seven"}});
+  projection->execute();
+  const auto output = projection->get_output();
+
+  EXPECT_EQ(output->col_count(), 2u);
+  EXPECT_EQ(output->column_type(ColumnID{0}), "string");
+  EXPECT_EQ(output->column_type(ColumnID{1}), "double");
+  EXPECT_EQ(_values<std::string>(output), (std::vector<std::string>{"one", "two", "three", "four", "five"}));
+  EXPECT_EQ(output->get_chunk(ChunkID{2}).get_column(ColumnID{1})->size(), 1u);
+  EXPECT_EQ((*output->get_chunk(ChunkID{2}).get_column(ColumnID{1}))[0], AllTypeVariant{7.5});
+}
+
+TEST_F(OperatorsProjectionTest, CompressedAndReferencedInput) {
+  _table->compress_chunk(ChunkID{0});
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  scan->execute();
+
+  const auto result = _project(ProjectionExpression::arithmetic(ArithmeticOperator::Multiplication,
+                                                                _column(ColumnID{0}), ProjectionExpression::literal(3)),
+                               scan);
+  EXPECT_EQ(_values<int32_t>(result), (std::vector<int32_t>{6, 9, 12, 15}));
+}
+
+TEST_F(OperatorsProjectionTest, IntegerOverflow) {
+  const auto max = ProjectionExpression::literal(std::numeric_limits<int32_t>::max());
+  const auto min = ProjectionExpression::literal(std::numeric_limits<int32_t>::min());
+  const auto project = [&](const ArithmeticOperator arithmetic_operator,
+                           const std::shared_ptr<ProjectionExpression>& left, const int32_t right) {
+    return _values<int32_t>(_project(
+        ProjectionExpression::arithmetic(arithmetic_operator, left, ProjectionExpression::literal(right))));
+  };
+
+  // the results wrap around
+  EXPECT_EQ(project(ArithmeticOperator::Addition, max, 1).front(), std::numeric_limits<int32_t>::min());
+  EXPECT_EQ(project(ArithmeticOperator::Subtraction, min, 1).front(), std::numeric_limits<int32_t>::max());
+  EXPECT_EQ(project(ArithmeticOperator::Multiplication, max, 2).front(), -2);
+  EXPECT_EQ(project(ArithmeticOperator::Multiplication, min, -1).front(), std::numeric_limits<int32_t>::min());
+
+  EXPECT_EQ(project(ArithmeticOperator::Division, min, 1).front(), std::numeric_limits<int32_t>::min());
+  EXPECT_THROW(project(ArithmeticOperator::Division, min, -1), std::logic_error);
+  EXPECT_THROW(_project(ProjectionExpression::arithmetic(
+                   ArithmeticOperator::Division, ProjectionExpression::literal(std::numeric_limits<int64_t>::min()),
+                   ProjectionExpression::literal(int64_t{-1}))),
+               std::logic_error);
+}
+
+TEST_F(OperatorsProjectionTest, InvalidExpressions) {
+  EXPECT_THROW(_project(ProjectionExpression::arithmetic(ArithmeticOperator::Addition, _column(ColumnID{0}),
+                                                         _column(ColumnID{4}))),
+               std::logic_error);
+  EXPECT_THROW(_project(ProjectionExpression::cast(_column(ColumnID{4}), "int")), std::logic_error);
+  EXPECT_THROW(ProjectionExpression::cast(_column(ColumnID{0}), "string"), std::logic_error);
+  EXPECT_THROW(_project(ProjectionExpression::arithmetic(ArithmeticOperator::Division, _column(ColumnID{0}),
+                                                         ProjectionExpression::literal(0))),
+               std::logic_error);
+}
+
+}  // namespace opossum
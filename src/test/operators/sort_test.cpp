@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/sort.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/type_cast.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class OperatorsSortTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("name", "string");
+    _table->add_column("age", "int");
+    _table->add_column("score", "double");
+    _table->append({"Bill", 40, 1.5});
+    _table->append({"Alexander", 30, 2.5});
+    _table->append({"Steve", 40, 0.5});
+    _table->append({"Hasso", 30, 2.5});
+    _table->append({"Bill", 20, 3.5});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // returns the values of a column in the order of the output
+  template <typename T>
+  static std::vector<T> _values(const std::shared_ptr<const Table>& table, const ColumnID column_id) {
+    std::vector<T> values;
+    const auto& column = *table->get_chunk(ChunkID{0}).get_column(column_id);
+    for (size_t row = 0; row < column.size(); ++row) values.push_back(type_cast<T>(column[row]));
+    return values;
+  }
+
+  std::shared_ptr<const Table> _sort(const std::vector<SortColumnDefinition>& definitions) {
+    auto sort = std::make_shared<Sort>(_table_wrapper, definitions);
+    sort->execute();
+    return sort->get_output();
+  }
+
+  // sorts a table that is large enough for the sort to use several jobs
+  void _test_many_chunks() {
+    const auto row_count = 200000;
+    auto table = std::make_shared<Table>(10000);
+    table->add_column("a", "int");
+    table->add_column("b", "int");
+    std::vector<int32_t> a(row_count);
+    std::vector<int32_t> b(row_count);
+    for (auto row = 0; row < row_count; ++row) {
+      a[row] = (row * 7919) % 1000;
+      b[row] = row;
+    }
+    table->append_column_batch(
+        {std::make_shared<ValueColumn<int32_t>>(std::move(a)), std::make_shared<ValueColumn<int32_t>>(std::move(b))});
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    for (const auto& sort_definitions : std::vector<std::vector<SortColumnDefinition>>{
+             {{ColumnID{0}, OrderByMode::Ascending}},
+             {{ColumnID{0}, OrderByMode::Ascending}, {ColumnID{1}, OrderByMode::Ascending}}}) {
+      auto sort = std::make_shared<Sort>(table_wrapper, sort_definitions);
+      sort->execute();
+
+      const auto& pos_list = *std::static_pointer_cast<const ReferenceColumn>(
+                                  sort->get_output()->get_chunk(ChunkID{0}).get_column(ColumnID{0}))
+                                  ->pos_list();
+      ASSERT_EQ(pos_list.size(), static_cast<size_t>(row_count));
+
+      const auto& first_column = [&](const RowID& row_id) {
+        const auto& column = *table->get_chunk(row_id.chunk_id).get_column(ColumnID{0});
+        return static_cast<const ValueColumn<int32_t>&>(column).get_typed(row_id.chunk_offset);
+      };
+      for (size_t row = 1; row < pos_list.size(); ++row) {
+        const auto previous = std::make_pair(first_column(pos_list[row - 1]), pos_list[row - 1]);
+        const auto current = std::make_pair(first_column(pos_list[row]), pos_list[row]);
+        ASSERT_TRUE(previous < current);
+      }
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsSortTest, SingleColumnAscending) {
+  const auto output = _sort({{ColumnID{1}, OrderByMode::Ascending}});
+  EXPECT_EQ(_values<int>(output, ColumnID{1}), (std::vector<int>{20, 30, 30, 40, 40}));
+  // equal rows keep their input order
+  EXPECT_EQ(_values<std::string>(output, ColumnID{0}),
+            (std::vector<std::string>{"Bill", "Alexander", "Hasso", "Bill", "Steve"}));
+}
+
+TEST_F(OperatorsSortTest, SingleColumnDescending) {
+  const auto output = _sort({{ColumnID{2}, OrderByMode::Descending}});
+  EXPECT_EQ(_values<double>(output, ColumnID{2}), (std::vector<double>{3.5, 2.5, 2.5, 1.5, 0.5}));
+  EXPECT_EQ(_values<std::string>(output, ColumnID{0}),
+            (std::vector<std::string>{"Bill", "Alexander", "Hasso", "Bill", "Steve"}));
+}
+
+TEST_F(OperatorsSortTest, MultipleColumns) {
+  const auto output = _sort({{ColumnID{1}, OrderByMode::Descending}, {ColumnID{0}, OrderByMode::Ascending}});
+  EXPECT_EQ(_values<std::string>(output, ColumnID{0}),
+            (std::vector<std::string>{"Bill", "Steve", "Alexander", "Hasso", "Bill"}));
+
+  const auto by_name = _sort({{ColumnID{0}, OrderByMode::Ascending}, {ColumnID{2}, OrderByMode::Descending}});
+  EXPECT_EQ(_values<double>(by_name, ColumnID{2}), (std::vector<double>{2.5, 3.5, 1.5, 2.5, 0.5}));
+}
+
+TEST_F(OperatorsSortTest, CompressedInput) {
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1});
+
+  const auto output = _sort({{ColumnID{0}, OrderByMode::Descending}});
+  EXPECT_EQ(_values<std::string>(output, ColumnID{0}),
+            (std::vector<std::string>{"Steve", "Hasso", "Bill", "Bill", "Alexander"}));
+}
+
+TEST_F(OperatorsSortTest, Nulls) {
+  auto right = std::make_shared<Table>(2);
+  right->add_column("age", "int");
+  right->add_column("group", "string");
+  right->append({30, "thirties"});
+  right->append({40, "forties"});
+  auto right_wrapper = std::make_shared<TableWrapper>(right);
+  right_wrapper->execute();
+
+  // Bill (20) has no partner, so his group is NULL
+  auto join = std::make_shared<JoinHash>(_table_wrapper, right_wrapper, JoinMode::Left,
+                                         std::make_pair(ColumnID{1}, ColumnID{0}));
+  join->execute();
+
+  const auto null_position = [](const std::shared_ptr<const Table>& table) {
+    const auto& column = *table->get_chunk(ChunkID{0}).get_column(ColumnID{4});
+    const auto& pos_list = *static_cast<const ReferenceColumn&>(column).pos_list();
+    return std::find(pos_list.cbegin(), pos_list.cend(), NULL_ROW_ID) - pos_list.cbegin();
+  };
+
+  for (const auto& sort_definitions : std::vector<std::vector<SortColumnDefinition>>{
+           {{ColumnID{4}, OrderByMode::Ascending}},
+           {{ColumnID{4}, OrderByMode::Descending}, {ColumnID{0}, OrderByMode::Ascending}}}) {
+    auto sort = std::make_shared<Sort>(join, sort_definitions);
+    sort->execute();
+    EXPECT_EQ(null_position(sort->get_output()), 0);
+  }
+
+  for (const auto& sort_definitions : std::vector<std::vector<SortColumnDefinition>>{
+           {{ColumnID{4}, OrderByMode::AscendingNullsLast}},
+           {{ColumnID{4}, OrderByMode::DescendingNullsLast}, {ColumnID{0}, OrderByMode::Ascending}}}) {
+    auto sort = std::make_shared<Sort>(join, sort_definitions);
+    sort->execute();
+    EXPECT_EQ(null_position(sort->get_output()), 4);
+  }
+}
+
+TEST_F(OperatorsSortTest, ManyChunks) { _test_many_chunks(); }
+
+TEST_F(OperatorsSortTest, ManyChunksWithScheduler) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+  _test_many_chunks();
+}
+
+}  // namespace opossum
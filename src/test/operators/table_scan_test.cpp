@@ -0,0 +1,169 @@
+#include <optional>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/index/group_key_index.hpp"
+#include "../lib/storage/index/sorted_position_index.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class OperatorsTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(10);
+    _table->add_column("a", "int");
+    _table->add_column("b", "long");
+    _table->add_column("c", "float");
+    _table->add_column("d", "double");
+    _table->add_column("e", "string");
+
+    // 25 rows, so that the chunks contain full SIMD blocks as well as a scalar remainder
+    for (int32_t i = 0; i < 25; ++i) {
+      _table->append({i % 7, int64_t{i} * 1000, i * 0.5f, i * 0.25, std::string(1, 'a' + i % 5)});
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // returns the matching rows as row numbers of _table
+  static std::vector<ChunkOffset> _rows(const std::shared_ptr<const Table>& table, const uint32_t chunk_size) {
+    const auto& column = table->get_chunk(ChunkID{0}).get_column(ColumnID{0});
+    const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column);
+
+    std::vector<ChunkOffset> rows;
+    for (const auto& row_id : *reference_column->pos_list()) {
+      rows.push_back(row_id.chunk_id * chunk_size + row_id.chunk_offset);
+    }
+    return rows;
+  }
+
+  std::vector<ChunkOffset> _scan(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant value,
+                                 const std::optional<AllTypeVariant> value2 = std::nullopt) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper, column_id, scan_type, value, value2);
+    scan->execute();
+
+    return _rows(scan->get_output(), _table->chunk_size());
+  }
+
+  void _expect_all_scan_types(const bool compressed) {
+    if (compressed) {
+      _table->compress_chunk(ChunkID{0});
+      _table->compress_chunk(ChunkID{1});
+    }
+
+    EXPECT_EQ(_scan(ColumnID{0}, ScanType::OpEquals, 3), (std::vector<ChunkOffset>{3, 10, 17, 24}));
+    EXPECT_EQ(_scan(ColumnID{0}, ScanType::OpNotEquals, 0).size(), 21u);
+    EXPECT_EQ(_scan(ColumnID{0}, ScanType::OpEquals, 42).size(), 0u);
+    EXPECT_EQ(_scan(ColumnID{0}, ScanType::OpNotEquals, 42).size(), 25u);
+    EXPECT_EQ(_scan(ColumnID{1}, ScanType::OpLessThan, 3000), (std::vector<ChunkOffset>{0, 1, 2}));
+    EXPECT_EQ(_scan(ColumnID{1}, ScanType::OpLessThanEquals, 3000), (std::vector<ChunkOffset>{0, 1, 2, 3}));
+    EXPECT_EQ(_scan(ColumnID{2}, ScanType::OpGreaterThan, 11.0f), (std::vector<ChunkOffset>{23, 24}));
+    EXPECT_EQ(_scan(ColumnID{2}, ScanType::OpGreaterThanEquals, 11.0f), (std::vector<ChunkOffset>{22, 23, 24}));
+    EXPECT_EQ(_scan(ColumnID{3}, ScanType::OpBetween, 2.0, 3.0), (std::vector<ChunkOffset>{8, 9, 10, 11, 12}));
+    EXPECT_EQ(_scan(ColumnID{4}, ScanType::OpEquals, "c"), (std::vector<ChunkOffset>{2, 7, 12, 17, 22}));
+    EXPECT_EQ(_scan(ColumnID{4}, ScanType::OpBetween, "b", "c").size(), 10u);
+    EXPECT_EQ(_scan(ColumnID{4}, ScanType::OpGreaterThan, "z").size(), 0u);
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTableScanTest, ScanValueColumns) { _expect_all_scan_types(false); }
+
+TEST_F(OperatorsTableScanTest, ScanDictionaryColumns) { _expect_all_scan_types(true); }
+
+TEST_F(OperatorsTableScanTest, ScanIndexedColumns) {
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1});
+  for (ColumnID column_id{0}; column_id < _table->col_count(); ++column_id) {
+    _table->get_chunk(ChunkID{0}).create_index<GroupKeyIndex>({column_id});
+    _table->get_chunk(ChunkID{1}).create_index<SortedPositionIndex>({column_id});
+    _table->get_chunk(ChunkID{2}).create_index<SortedPositionIndex>({column_id, ColumnID{0}});
+  }
+
+  _expect_all_scan_types(false);
+}
+
+TEST_F(OperatorsTableScanTest, ScanReferenceTable) {
+  _table->compress_chunk(ChunkID{1});
+
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 3);
+  scan_1->execute();
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{4}, ScanType::OpNotEquals, "a");
+  scan_2->execute();
+
+  // the result refers to the original table, not to the intermediate result
+  const auto& output = scan_2->get_output();
+  EXPECT_EQ(_rows(output, _table->chunk_size()), (std::vector<ChunkOffset>{1, 2, 7, 8, 9, 14, 16, 21, 22, 23}));
+  const auto column = output->get_chunk(ChunkID{0}).get_column(ColumnID{2});
+  EXPECT_EQ(std::dynamic_pointer_cast<const ReferenceColumn>(column)->referenced_table(), _table);
+
+  EXPECT_EQ(output->col_count(), 5u);
+  EXPECT_EQ(output->row_count(), 10u);
+  EXPECT_EQ(output->column_name(ColumnID{3}), "d");
+  EXPECT_EQ(type_cast<float>((*column)[9]), 11.5f);
+}
+
+TEST_F(OperatorsTableScanTest, ReferenceChunksOfDifferentTables) {
+  // the output resolves all positions against the table that the first chunk references, so a reference table whose
+  // chunks reference different tables would silently read the values of the wrong table
+  auto other_table = std::make_shared<Table>(10);
+  other_table->add_column("a", "int");
+  other_table->append({100});
+
+  const auto make_reference_table = [&](const std::shared_ptr<const Table>& second_table) {
+    auto table = std::make_shared<Table>();
+    table->add_column_definition("a", "int");
+    Chunk first_chunk;
+    first_chunk.add_column(std::make_shared<ReferenceColumn>(
+        _table, ColumnID{0}, std::make_shared<PosList>(PosList{RowID{ChunkID{0}, 1}})));
+    table->emplace_chunk(std::move(first_chunk));
+    Chunk second_chunk;
+    second_chunk.add_column(std::make_shared<ReferenceColumn>(
+        second_table, ColumnID{0}, std::make_shared<PosList>(PosList{RowID{ChunkID{0}, 0}})));
+    table->emplace_chunk(std::move(second_chunk));
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+  };
+
+  auto same_table_scan = make_reference_table(_table);
+  same_table_scan->execute();
+  EXPECT_EQ(_rows(same_table_scan->get_output(), _table->chunk_size()), (std::vector<ChunkOffset>{1, 0}));
+
+  if (IS_DEBUG) {
+    auto mixed_tables_scan = make_reference_table(other_table);
+    EXPECT_THROW(mixed_tables_scan->execute(), std::logic_error);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanEmptyTable) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 1);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsTableScanTest, BetweenNeedsTwoValues) {
+  EXPECT_THROW(TableScan(_table_wrapper, ColumnID{0}, ScanType::OpBetween, 1), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/sort.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/operators/top_k.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(7);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto row = 0; row < 100; ++row) {
+      table->append({(row * 37) % 23, std::to_string(row % 10)});
+    }
+    table->compress_chunk(ChunkID{3});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  static const PosList& _pos_list(const std::shared_ptr<const Table>& table) {
+    const auto& column = *table->get_chunk(ChunkID{0}).get_column(ColumnID{0});
+    return *static_cast<const ReferenceColumn&>(column).pos_list();
+  }
+
+  // TopK must return the same rows as the first rows of a full Sort
+  void _expect_prefix_of_sort(const std::shared_ptr<const AbstractOperator>& in, const SortColumnDefinition& definition,
+                              const size_t limit) {
+    auto sort = std::make_shared<Sort>(in, std::vector<SortColumnDefinition>{definition});
+    sort->execute();
+    auto top_k = std::make_shared<TopK>(in, definition, limit);
+    top_k->execute();
+
+    const auto& sorted = _pos_list(sort->get_output());
+    const auto expected = PosList(sorted.cbegin(), sorted.cbegin() + std::min(limit, sorted.size()));
+    EXPECT_EQ(_pos_list(top_k->get_output()), expected);
+    EXPECT_EQ(top_k->get_output()->col_count(), in->get_output()->col_count());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopKTest, MatchesSort) {
+  for (const auto limit : {1, 5, 10, 99, 100, 150}) {
+    _expect_prefix_of_sort(_table_wrapper, {ColumnID{0}, OrderByMode::Ascending}, limit);
+    _expect_prefix_of_sort(_table_wrapper, {ColumnID{0}, OrderByMode::Descending}, limit);
+    _expect_prefix_of_sort(_table_wrapper, {ColumnID{1}, OrderByMode::Descending}, limit);
+  }
+}
+
+TEST_F(OperatorsTopKTest, ZeroLimit) {
+  auto top_k = std::make_shared<TopK>(_table_wrapper, SortColumnDefinition{ColumnID{0}}, 0);
+  top_k->execute();
+  EXPECT_EQ(top_k->get_output()->row_count(), 0u);
+  EXPECT_EQ(top_k->get_output()->col_count(), 2u);
+}
+
+TEST_F(OperatorsTopKTest, Nulls) {
+  auto right = std::make_shared<Table>(2);
+  right->add_column("a", "int");
+  for (auto value = 0; value < 23; value += 3) right->append({value});
+  auto right_wrapper = std::make_shared<TableWrapper>(right);
+  right_wrapper->execute();
+
+  auto join = std::make_shared<JoinHash>(_table_wrapper, right_wrapper, JoinMode::Left,
+                                         std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending, OrderByMode::AscendingNullsLast,
+                                   OrderByMode::DescendingNullsLast}) {
+    for (const auto limit : {3, 50, 80}) {
+      _expect_prefix_of_sort(join, {ColumnID{2}, order_by_mode}, limit);
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,136 @@
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/projection.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/job_task.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class SchedulerTest : public BaseTest {};
+
+TEST_F(SchedulerTest, ExecuteWithoutScheduler) {
+  auto counter = 0;
+  auto task = std::make_shared<JobTask>([&]() { ++counter; });
+  task->schedule();
+
+  // without a scheduler, tasks are executed right away
+  EXPECT_TRUE(task->is_done());
+  EXPECT_EQ(counter, 1);
+  EXPECT_THROW(task->schedule(), std::exception);
+}
+
+TEST_F(SchedulerTest, ExecuteManyTasks) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+
+  std::atomic<uint32_t> counter{0};
+  std::vector<std::shared_ptr<AbstractTask>> tasks;
+  for (auto i = 0; i < 1000; ++i) {
+    tasks.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_EQ(counter, 1000u);
+  for (const auto& task : tasks) EXPECT_TRUE(task->is_done());
+}
+
+TEST_F(SchedulerTest, NestedTasks) {
+  // more waiting tasks than workers must not deadlock, as waiting workers keep executing other tasks
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(2));
+
+  std::atomic<uint32_t> counter{0};
+  std::vector<std::shared_ptr<AbstractTask>> tasks;
+  for (auto i = 0; i < 8; ++i) {
+    tasks.emplace_back(std::make_shared<JobTask>([&]() {
+      std::vector<std::shared_ptr<AbstractTask>> subtasks;
+      for (auto j = 0; j < 10; ++j) {
+        subtasks.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+      }
+      CurrentScheduler::schedule_and_wait_for_tasks(subtasks);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_EQ(counter, 80u);
+}
+
+TEST_F(SchedulerTest, FinishExecutesRemainingTasks) {
+  auto scheduler = std::make_shared<TaskScheduler>(1);
+  CurrentScheduler::set(scheduler);
+
+  std::atomic<uint32_t> counter{0};
+  for (auto i = 0; i < 100; ++i) {
+    std::make_shared<JobTask>([&]() { ++counter; })->schedule();
+  }
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_EQ(counter, 100u);
+}
+
+TEST_F(SchedulerTest, ParallelTableScan) {
+  auto table = std::make_shared<Table>(7);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 100; ++i) table->append({i % 10});
+
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+  scan->execute();
+
+  // the result keeps the order of the chunks
+  auto expected = std::make_shared<Table>(7);
+  expected->add_column("a", "int");
+  for (auto i = 0; i < 10; ++i) expected->append({3});
+  EXPECT_TABLE_EQ(scan->get_output(), expected, true);
+}
+
+TEST_F(SchedulerTest, ExceptionsReachTheWaitingThread) {
+  for (const auto worker_count : {0, 2}) {
+    if (worker_count > 0) CurrentScheduler::set(std::make_shared<TaskScheduler>(worker_count));
+
+    std::atomic<uint32_t> counter{0};
+    std::vector<std::shared_ptr<AbstractTask>> tasks;
+    for (auto i = 0; i < 10; ++i) {
+      tasks.emplace_back(std::make_shared<JobTask>([&, i]() {
+        ++counter;
+        if (i % 3 == 1) throw std::logic_error("job failed");
+      }));
+    }
+    EXPECT_THROW(CurrentScheduler::schedule_and_wait_for_tasks(tasks), std::logic_error);
+
+    // the other tasks still ran, and all tasks are done
+    EXPECT_EQ(counter, 10u);
+    for (const auto& task : tasks) EXPECT_TRUE(task->is_done());
+    EXPECT_THROW(tasks[1]->join(), std::logic_error);
+    EXPECT_NO_THROW(tasks[0]->join());
+  }
+}
+
+TEST_F(SchedulerTest, FailingOperatorJob) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 6; ++i) table->append({i});
+
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(2));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  // 1 / a fails for the row with a = 0
+  const auto quotient = ProjectionExpression::arithmetic(
+      ArithmeticOperator::Division, ProjectionExpression::literal(1), ProjectionExpression::column(ColumnID{0}));
+  auto projection = std::make_shared<Projection>(table_wrapper, std::vector<ProjectionDefinition>{{quotient, "q"}});
+  EXPECT_THROW(projection->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/equi_depth_histogram.hpp"
+
+namespace opossum {
+
+class StatisticsEquiDepthHistogramTest : public BaseTest {};
+
+TEST_F(StatisticsEquiDepthHistogramTest, Buckets) {
+  // 1 is frequent enough to get a bucket of its own, even though it exceeds the depth of 3
+  const auto histogram = EquiDepthHistogram<int32_t>({1, 1, 1, 1, 1, 2, 3, 3, 4, 7, 8, 9}, 4);
+  const auto& buckets = histogram.buckets();
+  ASSERT_EQ(buckets.size(), 4u);
+
+  EXPECT_EQ(buckets[0].min, 1);
+  EXPECT_EQ(buckets[0].max, 1);
+  EXPECT_EQ(buckets[0].count, 5u);
+  EXPECT_EQ(buckets[0].distinct_count, 1u);
+
+  EXPECT_EQ(buckets[1].min, 2);
+  EXPECT_EQ(buckets[1].max, 3);
+  EXPECT_EQ(buckets[1].count, 3u);
+  EXPECT_EQ(buckets[1].distinct_count, 2u);
+
+  EXPECT_EQ(buckets[2].min, 4);
+  EXPECT_EQ(buckets[2].max, 8);
+  EXPECT_EQ(buckets[3].min, 9);
+  EXPECT_EQ(buckets[3].count, 1u);
+  EXPECT_EQ(histogram.total_count(), 12u);
+}
+
+TEST_F(StatisticsEquiDepthHistogramTest, Estimates) {
+  std::vector<double> values;
+  for (auto value = 0; value < 1000; ++value) values.push_back(value);
+  const auto histogram = EquiDepthHistogram<double>(values, 10);
+
+  EXPECT_EQ(histogram.estimate_less_than(-1.0), 0.0);
+  EXPECT_EQ(histogram.estimate_less_than(2000.0), 1000.0);
+  EXPECT_NEAR(histogram.estimate_less_than(250.0), 250.0, 1.0);
+  EXPECT_NEAR(histogram.estimate_equals(42.0), 1.0, 0.01);
+  EXPECT_EQ(histogram.estimate_equals(1000.5), 0.0);
+}
+
+TEST_F(StatisticsEquiDepthHistogramTest, Strings) {
+  const auto histogram = EquiDepthHistogram<std::string>({"a", "a", "b", "c", "d", "e"}, 2);
+  EXPECT_EQ(histogram.buckets().size(), 2u);
+  EXPECT_EQ(histogram.estimate_less_than("a"), 0.0);
+  EXPECT_EQ(histogram.estimate_less_than("z"), 6.0);
+  EXPECT_EQ(histogram.estimate_equals("a"), 1.5);
+  EXPECT_EQ(histogram.estimate_equals("aa"), 1.5);
+  EXPECT_EQ(histogram.estimate_equals("f"), 0.0);
+}
+
+}  // namespace opossum
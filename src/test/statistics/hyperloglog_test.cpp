@@ -0,0 +1,38 @@
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/hyperloglog.hpp"
+
+namespace opossum {
+
+class StatisticsHyperLogLogTest : public BaseTest {};
+
+TEST_F(StatisticsHyperLogLogTest, EmptySketch) { EXPECT_EQ(HyperLogLog{}.estimate(), 0.0); }
+
+TEST_F(StatisticsHyperLogLogTest, Estimate) {
+  for (const auto distinct_count : {10, 1000, 100000}) {
+    HyperLogLog sketch;
+    // every value is added three times, which must not change the estimate
+    for (auto repetition = 0; repetition < 3; ++repetition) {
+      for (auto value = 0; value < distinct_count; ++value) sketch.add(int64_t{value} * 1024);
+    }
+    EXPECT_NEAR(sketch.estimate(), distinct_count, distinct_count * 0.05);
+  }
+}
+
+TEST_F(StatisticsHyperLogLogTest, Merge) {
+  HyperLogLog left;
+  HyperLogLog right;
+  for (auto value = 0; value < 20000; ++value) left.add(std::to_string(value));
+  for (auto value = 10000; value < 30000; ++value) right.add(std::to_string(value));
+
+  left.merge(right);
+  EXPECT_NEAR(left.estimate(), 30000, 30000 * 0.05);
+
+  EXPECT_THROW(left.merge(HyperLogLog{10}), std::logic_error);
+  EXPECT_THROW(HyperLogLog{2}, std::logic_error);
+}
+
+}  // namespace opossum
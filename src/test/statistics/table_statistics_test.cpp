@@ -0,0 +1,152 @@
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/statistics/column_statistics.hpp"
+#include "../lib/statistics/table_statistics.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StatisticsTableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 10 chunks of 100 rows and a last chunk with 50 rows, which is not part of the statistics yet
+    _table = std::make_shared<Table>(100);
+    _table->add_column("id", "int");
+    _table->add_column("category", "string");
+    _table->add_column("price", "double");
+    for (auto row = 0; row < 1050; ++row) {
+      _table->append({row, row % 10 == 0 ? "rare" : "common", (row % 100) * 0.5});
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StatisticsTableStatisticsTest, MaintainedWhenChunksAreSealed) {
+  const auto statistics = _table->table_statistics();
+  EXPECT_EQ(statistics->row_count(), 1000u);
+
+  _table->compress_chunk(ChunkID{3});
+  EXPECT_EQ(statistics->row_count(), 1000u);
+
+  // compressing the last chunk seals it
+  _table->compress_chunk(ChunkID{10});
+  EXPECT_EQ(statistics->row_count(), 1050u);
+
+  // ... unless it is sealed already
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  table->append_concurrently({1});
+  table->append_concurrently({2});
+  table->flush_concurrent_appends();
+  EXPECT_EQ(table->table_statistics()->row_count(), 2u);
+  table->compress_chunk(ChunkID{0});
+  EXPECT_EQ(table->table_statistics()->row_count(), 2u);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0}).is_sealed());
+  EXPECT_EQ(table->get_chunk(ChunkID{0}).zone_map(ColumnID{0})->max, AllTypeVariant{2});
+  EXPECT_EQ(table->chunk_count(), 2u);
+}
+
+TEST_F(StatisticsTableStatisticsTest, ColumnStatistics) {
+  const auto statistics = _table->table_statistics();
+  EXPECT_NEAR(statistics->column_statistics(ColumnID{0}).distinct_count(), 1000.0, 50.0);
+  EXPECT_NEAR(statistics->column_statistics(ColumnID{1}).distinct_count(), 2.0, 0.1);
+  EXPECT_NEAR(statistics->column_statistics(ColumnID{2}).distinct_count(), 100.0, 5.0);
+  EXPECT_EQ(statistics->column_statistics(ColumnID{0}).null_fraction(), 0.0);
+}
+
+TEST_F(StatisticsTableStatisticsTest, Selectivity) {
+  const auto statistics = _table->table_statistics();
+
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 250), 0.25, 0.01);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 900), 0.1, 0.01);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 17), 0.001, 0.0005);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpBetween, 100, 199), 0.1, 0.01);
+  EXPECT_EQ(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpBetween, 199, 100), 0.0);
+  EXPECT_EQ(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThan, 5000), 0.0);
+
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{1}, ScanType::OpEquals, "rare"), 0.1, 0.001);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{1}, ScanType::OpNotEquals, "rare"), 0.9, 0.001);
+
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{2}, ScanType::OpLessThanEquals, 4.5), 0.1, 0.01);
+  EXPECT_NEAR(statistics->estimate_cardinality(ColumnID{2}, ScanType::OpGreaterThan, 44.5), 100.0, 10.0);
+}
+
+TEST_F(StatisticsTableStatisticsTest, JoinCardinality) {
+  auto right = std::make_shared<Table>(100);
+  right->add_column("id", "int");
+  for (auto row = 0; row < 500; ++row) right->append({row % 250});
+  right->create_new_chunk();
+
+  // every right row finds exactly one partner
+  const auto estimate =
+      _table->table_statistics()->estimate_join_cardinality(ColumnID{0}, *right->table_statistics(), ColumnID{0});
+  EXPECT_NEAR(estimate, 500.0, 50.0);
+}
+
+TEST_F(StatisticsTableStatisticsTest, NullFraction) {
+  auto right = std::make_shared<Table>(10);
+  right->add_column("id", "int");
+  for (auto row = 0; row < 10; ++row) right->append({row});
+
+  auto left_wrapper = std::make_shared<TableWrapper>(_table);
+  left_wrapper->execute();
+  auto right_wrapper = std::make_shared<TableWrapper>(right);
+  right_wrapper->execute();
+  auto join = std::make_shared<JoinHash>(left_wrapper, right_wrapper, JoinMode::Left,
+                                         std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  // 10 of the 1050 rows of the join result have a partner
+  const auto& output = *join->get_output();
+  ColumnStatistics<int32_t> column_statistics;
+  for (ChunkID chunk_id{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    column_statistics.add_column(*output.get_chunk(chunk_id).get_column(ColumnID{3}));
+  }
+  EXPECT_EQ(column_statistics.row_count(), 1050u);
+  EXPECT_NEAR(column_statistics.null_fraction(), 1040.0 / 1050.0, 0.0001);
+  EXPECT_NEAR(column_statistics.distinct_count(), 10.0, 0.5);
+  EXPECT_NEAR(column_statistics.estimate_selectivity(ScanType::OpNotEquals, 3), 9.0 / 1050.0, 0.0001);
+}
+
+TEST_F(StatisticsTableStatisticsTest, NaNs) {
+  // 2% of the values are NaN, which satisfy no predicate but !=
+  std::vector<double> values;
+  auto less_than_count = 0;
+  for (auto row = 0; row < 10000; ++row) {
+    if (row % 50 == 0) {
+      values.push_back(std::numeric_limits<double>::quiet_NaN());
+    } else {
+      values.push_back(static_cast<double>((row * 7919) % 1000));
+      if (values.back() < 500.0) ++less_than_count;
+    }
+  }
+
+  ColumnStatistics<double> column_statistics;
+  column_statistics.add_column(ValueColumn<double>(std::move(values)));
+  EXPECT_EQ(column_statistics.row_count(), 10000u);
+  EXPECT_NEAR(column_statistics.distinct_count(), 1000.0, 50.0);
+
+  const auto less_than = column_statistics.estimate_selectivity(ScanType::OpLessThan, 500.0);
+  ASSERT_FALSE(std::isnan(less_than));
+  EXPECT_NEAR(less_than * 10000, less_than_count, 100.0);
+  EXPECT_NEAR(column_statistics.estimate_selectivity(ScanType::OpGreaterThanEquals, 500.0), 0.49, 0.01);
+  EXPECT_NEAR(column_statistics.estimate_selectivity(ScanType::OpNotEquals, 3.0), 0.999, 0.001);
+
+  const auto nan = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_EQ(column_statistics.estimate_selectivity(ScanType::OpEquals, nan), 0.0);
+  EXPECT_EQ(column_statistics.estimate_selectivity(ScanType::OpNotEquals, nan), 1.0);
+}
+
+}  // namespace opossum
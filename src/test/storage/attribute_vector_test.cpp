@@ -0,0 +1,84 @@
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/fitted_attribute_vector.hpp"
+#include "../lib/storage/fixed_size_attribute_vector.hpp"
+
+namespace opossum {
+
+class StorageAttributeVectorTest : public BaseTest {};
+
+TEST_F(StorageAttributeVectorTest, FixedSizeSetAndGet) {
+  FixedSizeAttributeVector<uint16_t> attribute_vector{3};
+  attribute_vector.set(0, ValueID{1000});
+  attribute_vector.set(2, ValueID{65535});
+
+  EXPECT_EQ(attribute_vector.size(), 3u);
+  EXPECT_EQ(attribute_vector.width(), 16u);
+  EXPECT_EQ(attribute_vector.get(0), ValueID{1000});
+  EXPECT_EQ(attribute_vector.get(1), ValueID{0});
+  EXPECT_EQ(attribute_vector.get(2), ValueID{65535});
+}
+
+TEST_F(StorageAttributeVectorTest, BitPackedSetAndGet) {
+  // with 7 bits, values regularly span two 64-bit words
+  BitPackedAttributeVector attribute_vector{100, 7};
+  for (size_t i = 0; i < 100; ++i) {
+    attribute_vector.set(i, ValueID{static_cast<uint32_t>((i * 37) % 128)});
+  }
+
+  EXPECT_EQ(attribute_vector.size(), 100u);
+  EXPECT_EQ(attribute_vector.width(), 7u);
+  for (size_t i = 0; i < 100; ++i) {
+    EXPECT_EQ(attribute_vector.get(i), ValueID{static_cast<uint32_t>((i * 37) % 128)});
+  }
+
+  // overwriting must not touch the neighbours
+  attribute_vector.set(9, ValueID{0});
+  EXPECT_EQ(attribute_vector.get(8), ValueID{(8 * 37) % 128});
+  EXPECT_EQ(attribute_vector.get(9), ValueID{0});
+  EXPECT_EQ(attribute_vector.get(10), ValueID{(10 * 37) % 128});
+}
+
+TEST_F(StorageAttributeVectorTest, BitPackedFullWidth) {
+  BitPackedAttributeVector attribute_vector{5, 32};
+  attribute_vector.set(1, ValueID{4294967294u});
+  attribute_vector.set(4, ValueID{123456789u});
+  EXPECT_EQ(attribute_vector.get(0), ValueID{0});
+  EXPECT_EQ(attribute_vector.get(1), ValueID{4294967294u});
+  EXPECT_EQ(attribute_vector.get(4), ValueID{123456789u});
+}
+
+TEST_F(StorageAttributeVectorTest, FittedWidth) {
+  EXPECT_EQ(attribute_vector_width_for(0), 1u);
+  EXPECT_EQ(attribute_vector_width_for(2), 1u);
+  EXPECT_EQ(attribute_vector_width_for(3), 2u);
+  EXPECT_EQ(attribute_vector_width_for(256), 8u);
+  EXPECT_EQ(attribute_vector_width_for(257), 9u);
+  EXPECT_EQ(attribute_vector_width_for(65536), 16u);
+
+  EXPECT_NE(std::dynamic_pointer_cast<BitPackedAttributeVector>(make_fitted_attribute_vector(5, 10)), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<FixedSizeAttributeVector<uint8_t>>(make_fitted_attribute_vector(200, 10)),
+            nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<FixedSizeAttributeVector<uint16_t>>(make_fitted_attribute_vector(60000, 10)),
+            nullptr);
+  EXPECT_EQ(make_fitted_attribute_vector(1000, 10)->width(), 10u);
+}
+
+TEST_F(StorageAttributeVectorTest, ResolveAttributeVector) {
+  auto attribute_vector = make_fitted_attribute_vector(1000, 3);
+  attribute_vector->set(2, ValueID{999});
+
+  auto sum = uint32_t{0};
+  resolve_attribute_vector(*attribute_vector, [&](const auto& typed_attribute_vector) {
+    for (size_t i = 0; i < typed_attribute_vector.size(); ++i) sum += typed_attribute_vector.get(i);
+  });
+  EXPECT_EQ(sum, 999u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,122 @@
+#include <memory_resource>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/column_arena.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/utils/numa_memory_resource.hpp"
+
+namespace opossum {
+
+// counts the allocations that it passes on to new and delete
+class CountingMemoryResource : public std::pmr::memory_resource {
+ public:
+  size_t allocation_count = 0;
+  size_t deallocation_count = 0;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    ++allocation_count;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+    ++deallocation_count;
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+class StorageColumnArenaTest : public BaseTest {};
+
+TEST_F(StorageColumnArenaTest, ColumnsKeepTheirArena) {
+  auto upstream = std::make_shared<CountingMemoryResource>();
+  auto arena = std::make_shared<ColumnArena>(1024, upstream);
+
+  auto ints = std::make_shared<ValueColumn<int32_t>>(arena);
+  auto strings = std::make_shared<ValueColumn<std::string>>(arena);
+  ints->reserve(100);
+  strings->reserve(10);
+  for (auto value = 0; value < 100; ++value) ints->append(value);
+  strings->append("a string that does not fit into the small string buffer");
+  arena.reset();
+
+  // both columns fit into the initial block
+  EXPECT_EQ(upstream->allocation_count, 1u);
+  EXPECT_EQ(ints->values().get_allocator().resource(), strings->values().get_allocator().resource());
+  EXPECT_EQ(ints->get_typed(99), 99);
+
+  // shrinking would not free anything
+  ints->shrink_to_fit();
+  EXPECT_EQ(ints->values().capacity(), 100u);
+
+  // the block is freed with the last column
+  ints.reset();
+  EXPECT_EQ(upstream->deallocation_count, 0u);
+  strings.reset();
+  EXPECT_EQ(upstream->deallocation_count, 1u);
+}
+
+TEST_F(StorageColumnArenaTest, TakeOverValues) {
+  auto arena = std::make_shared<ColumnArena>();
+  pmr_vector<int64_t> values({1, 2, 3}, arena.get());
+  const auto data = values.data();
+
+  ValueColumn<int64_t> column(std::move(values), arena);
+  EXPECT_EQ(column.data(), data);
+
+  // values of another resource are moved into the arena
+  column.append_values(pmr_vector<int64_t>{4, 5});
+  EXPECT_EQ(column.size(), 5u);
+  EXPECT_EQ(column.values().get_allocator().resource(), arena.get());
+}
+
+TEST_F(StorageColumnArenaTest, TableWithArena) {
+  auto upstream = std::make_shared<CountingMemoryResource>();
+  std::weak_ptr<ColumnArena> weak_arena;
+  {
+    auto arena = std::make_shared<ColumnArena>(ColumnArena::DEFAULT_INITIAL_BLOCK_SIZE, upstream);
+    weak_arena = arena;
+
+    Table table(4, arena);
+    table.add_column("a", "int");
+    table.add_column("b", "double");
+    for (auto row = 0; row < 10; ++row) table.append({row, row * 0.5});
+    for (auto row = 0; row < 10; ++row) table.append_concurrently({row, row * 0.5});
+    table.flush_concurrent_appends();
+    EXPECT_EQ(table.row_count(), 20u);
+    EXPECT_EQ(table.memory_resource(), arena);
+
+    const auto column = std::dynamic_pointer_cast<const ValueColumn<double>>(
+        table.get_chunk(ChunkID{2}).get_column(ColumnID{1}));
+    EXPECT_EQ(column->values().get_allocator().resource(), arena.get());
+    EXPECT_EQ(column->get_typed(1), 4.5);
+  }
+
+  // dropping the table frees all of its values at once
+  EXPECT_TRUE(weak_arena.expired());
+  EXPECT_EQ(upstream->allocation_count, upstream->deallocation_count);
+}
+
+TEST_F(StorageColumnArenaTest, NumaMemoryResource) {
+  auto numa_resource = std::make_shared<NumaMemoryResource>(0);
+  EXPECT_EQ(numa_resource->node_id(), 0);
+  EXPECT_TRUE(numa_resource->is_equal(NumaMemoryResource(0)));
+  EXPECT_FALSE(numa_resource->is_equal(NumaMemoryResource(1)));
+
+  auto arena = std::make_shared<ColumnArena>(4096, numa_resource);
+  ValueColumn<int32_t> column(arena);
+  for (auto value = 0; value < 10000; ++value) column.append(value);
+  EXPECT_EQ(column.get_typed(9999), 9999);
+
+  EXPECT_THROW(NumaMemoryResource(64), std::exception);
+}
+
+}  // namespace opossum
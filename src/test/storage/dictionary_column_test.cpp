@@ -0,0 +1,93 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/base_column.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageDictionaryColumnTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueColumn<int>> vc_int = std::make_shared<ValueColumn<int>>();
+  std::shared_ptr<ValueColumn<std::string>> vc_str = std::make_shared<ValueColumn<std::string>>();
+};
+
+TEST_F(StorageDictionaryColumnTest, CompressColumnString) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+  vc_str->append("Steve");
+  vc_str->append("Hasso");
+  vc_str->append("Bill");
+
+  auto col = make_shared_by_column_type<BaseColumn, DictionaryColumn>("string", vc_str);
+  auto dict_col = std::dynamic_pointer_cast<DictionaryColumn<std::string>>(col);
+
+  // Test attribute_vector size
+  EXPECT_EQ(dict_col->size(), 6u);
+
+  // Test dictionary size (uniqueness)
+  EXPECT_EQ(dict_col->unique_values_count(), 4u);
+
+  // Test sorting
+  auto dict = dict_col->dictionary();
+  EXPECT_EQ((*dict)[0], "Alexander");
+  EXPECT_EQ((*dict)[1], "Bill");
+  EXPECT_EQ((*dict)[2], "Hasso");
+  EXPECT_EQ((*dict)[3], "Steve");
+
+  // Test values
+  EXPECT_EQ(dict_col->get(0), "Bill");
+  EXPECT_EQ(dict_col->get(3), "Steve");
+  EXPECT_EQ(type_cast<std::string>((*dict_col)[4]), "Hasso");
+}
+
+TEST_F(StorageDictionaryColumnTest, LowerUpperBound) {
+  for (int i = 0; i <= 10; i += 2) vc_int->append(i);
+  auto col = make_shared_by_column_type<BaseColumn, DictionaryColumn>("int", vc_int);
+  auto dict_col = std::dynamic_pointer_cast<DictionaryColumn<int>>(col);
+
+  EXPECT_EQ(dict_col->lower_bound(4), (ValueID)2);
+  EXPECT_EQ(dict_col->upper_bound(4), (ValueID)3);
+
+  EXPECT_EQ(dict_col->lower_bound(AllTypeVariant{5}), (ValueID)3);
+  EXPECT_EQ(dict_col->upper_bound(AllTypeVariant{5}), (ValueID)3);
+
+  EXPECT_EQ(dict_col->lower_bound(15), INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col->upper_bound(10), INVALID_VALUE_ID);
+}
+
+TEST_F(StorageDictionaryColumnTest, ValueByValueId) {
+  vc_int->append(7);
+  vc_int->append(3);
+  vc_int->append(7);
+  auto dict_col = std::make_shared<DictionaryColumn<int>>(vc_int);
+
+  EXPECT_EQ(dict_col->value_by_value_id(ValueID{0}), 3);
+  EXPECT_EQ(dict_col->value_by_value_id(ValueID{1}), 7);
+  EXPECT_THROW(dict_col->value_by_value_id(ValueID{2}), std::exception);
+
+  const auto& attribute_vector = *dict_col->attribute_vector();
+  EXPECT_EQ(attribute_vector.width(), 1u);
+  EXPECT_EQ(attribute_vector.get(0), ValueID{1});
+  EXPECT_EQ(attribute_vector.get(1), ValueID{0});
+  EXPECT_EQ(attribute_vector.get(2), ValueID{1});
+}
+
+TEST_F(StorageDictionaryColumnTest, Immutable) {
+  vc_int->append(1);
+  auto dict_col = std::make_shared<DictionaryColumn<int>>(vc_int);
+  EXPECT_THROW(dict_col->append(2), std::exception);
+}
+
+TEST_F(StorageDictionaryColumnTest, WrongColumnType) {
+  EXPECT_THROW(std::make_shared<DictionaryColumn<std::string>>(vc_int), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,163 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/index/adaptive_radix_tree_index.hpp"
+#include "../lib/storage/index/group_key_index.hpp"
+#include "../lib/storage/index/sorted_position_index.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/type_cast.hpp"
+
+namespace opossum {
+
+class StorageIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto names = std::make_shared<ValueColumn<std::string>>();
+    auto ages = std::make_shared<ValueColumn<int32_t>>();
+    for (const auto& name : {"Hasso", "Bill", "Steve", "Alexander", "Bill", "Hasso"}) names->append(name);
+    for (const auto age : {30, 40, 40, 30, 20, 25}) ages->append(age);
+
+    _chunk.add_column(std::make_shared<DictionaryColumn<std::string>>(names));
+    _chunk.add_column(ages);
+  }
+
+  // returns the offsets in [begin, end)
+  static std::vector<ChunkOffset> _offsets(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  // checks lookups on the names, which every index type supports
+  static void _expect_name_lookups(const BaseIndex& index) {
+    EXPECT_EQ(_offsets(index.cbegin(), index.cend()), (std::vector<ChunkOffset>{3, 1, 4, 0, 5, 2}));
+
+    EXPECT_EQ(_offsets(index.lower_bound({"Bill"}), index.upper_bound({"Bill"})), (std::vector<ChunkOffset>{1, 4}));
+    EXPECT_EQ(_offsets(index.lower_bound({"Hasso"}), index.cend()), (std::vector<ChunkOffset>{0, 5, 2}));
+    EXPECT_EQ(_offsets(index.cbegin(), index.lower_bound({"Bill"})), (std::vector<ChunkOffset>{3}));
+
+    // values that are not in the chunk
+    EXPECT_EQ(index.lower_bound({"Carl"}), index.upper_bound({"Carl"}));
+    EXPECT_EQ(_offsets(index.lower_bound({"Carl"}), index.upper_bound({"Steve"})),
+              (std::vector<ChunkOffset>{0, 5, 2}));
+    EXPECT_EQ(index.lower_bound({"Zed"}), index.cend());
+    EXPECT_EQ(index.upper_bound({"Aaron"}), index.cbegin());
+  }
+
+  // checks lookups on the names and ages, which index types for multiple columns support
+  template <typename Index>
+  void _expect_multiple_column_lookups() {
+    const auto index = _chunk.create_index<Index>({ColumnID{0}, ColumnID{1}});
+    EXPECT_EQ(_offsets(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{3, 4, 1, 5, 0, 2}));
+
+    EXPECT_EQ(_offsets(index->lower_bound({"Hasso", 30}), index->upper_bound({"Hasso", 30})),
+              (std::vector<ChunkOffset>{0}));
+    EXPECT_EQ(_offsets(index->lower_bound({"Bill", 30}), index->upper_bound({"Hasso", 25})),
+              (std::vector<ChunkOffset>{1, 5}));
+    EXPECT_EQ(index->lower_bound({"Bill", 35}), index->upper_bound({"Bill", 35}));
+
+    // lookups on the first column only
+    EXPECT_EQ(_offsets(index->lower_bound({"Bill"}), index->upper_bound({"Bill"})),
+              (std::vector<ChunkOffset>{4, 1}));
+  }
+
+  Chunk _chunk;
+};
+
+TEST_F(StorageIndexTest, GroupKeyIndex) {
+  const auto index = _chunk.create_index<GroupKeyIndex>({ColumnID{0}});
+  _expect_name_lookups(*index);
+
+  EXPECT_THROW(_chunk.create_index<GroupKeyIndex>({ColumnID{1}}), std::exception);
+  EXPECT_THROW(_chunk.create_index<GroupKeyIndex>({ColumnID{0}, ColumnID{1}}), std::exception);
+}
+
+TEST_F(StorageIndexTest, SortedPositionIndex) {
+  _expect_name_lookups(*_chunk.create_index<SortedPositionIndex>({ColumnID{0}}));
+
+  const auto age_index = _chunk.create_index<SortedPositionIndex>({ColumnID{1}});
+  EXPECT_EQ(_offsets(age_index->cbegin(), age_index->cend()), (std::vector<ChunkOffset>{4, 5, 0, 3, 1, 2}));
+  EXPECT_EQ(_offsets(age_index->lower_bound({25}), age_index->upper_bound({30})),
+            (std::vector<ChunkOffset>{5, 0, 3}));
+  // search values are converted to the column type
+  EXPECT_EQ(_offsets(age_index->lower_bound({int64_t{40}}), age_index->cend()), (std::vector<ChunkOffset>{1, 2}));
+}
+
+TEST_F(StorageIndexTest, AdaptiveRadixTreeIndex) {
+  _expect_name_lookups(*_chunk.create_index<AdaptiveRadixTreeIndex>({ColumnID{0}}));
+
+  const auto age_index = _chunk.create_index<AdaptiveRadixTreeIndex>({ColumnID{1}});
+  EXPECT_EQ(_offsets(age_index->cbegin(), age_index->cend()), (std::vector<ChunkOffset>{4, 5, 0, 3, 1, 2}));
+  EXPECT_EQ(_offsets(age_index->lower_bound({25}), age_index->upper_bound({30})),
+            (std::vector<ChunkOffset>{5, 0, 3}));
+  EXPECT_EQ(_offsets(age_index->lower_bound({int64_t{40}}), age_index->cend()), (std::vector<ChunkOffset>{1, 2}));
+  EXPECT_EQ(age_index->lower_bound({-5}), age_index->cbegin());
+}
+
+TEST_F(StorageIndexTest, MultipleColumns) {
+  _expect_multiple_column_lookups<SortedPositionIndex>();
+  _expect_multiple_column_lookups<AdaptiveRadixTreeIndex>();
+}
+
+TEST_F(StorageIndexTest, AdaptiveRadixTreeIndexManyKeys) {
+  // enough distinct keys for all node sizes, compared with the plain sorted index
+  std::mt19937 generator{42};
+  auto longs = std::make_shared<ValueColumn<int64_t>>();
+  auto strings = std::make_shared<ValueColumn<std::string>>();
+  auto doubles = std::make_shared<ValueColumn<double>>();
+  for (auto row = 0; row < 20000; ++row) {
+    const auto random = generator();
+    longs->append(row % 3 == 0 ? static_cast<int64_t>(random) << 20 : static_cast<int64_t>(random % 3000) - 1500);
+    strings->append(std::string(1 + random % 5, static_cast<char>('a' + random % 40)) + std::to_string(random % 100));
+    doubles->append(static_cast<double>(random % 1000) / 8);
+  }
+
+  Chunk chunk;
+  chunk.add_column(longs);
+  chunk.add_column(strings);
+  chunk.add_column(std::make_shared<DictionaryColumn<double>>(doubles));
+
+  for (const auto& column_ids : std::vector<std::vector<ColumnID>>{
+           {ColumnID{0}}, {ColumnID{1}}, {ColumnID{2}}, {ColumnID{1}, ColumnID{0}}}) {
+    const auto tree = chunk.create_index<AdaptiveRadixTreeIndex>(column_ids);
+    const auto sorted = chunk.create_index<SortedPositionIndex>(column_ids);
+    ASSERT_EQ(_offsets(tree->cbegin(), tree->cend()), _offsets(sorted->cbegin(), sorted->cend()));
+
+    for (auto lookup = 0; lookup < 2000; ++lookup) {
+      // search for values of the chunk as well as for values that are not in it
+      const auto row = generator() % chunk.size();
+      std::vector<AllTypeVariant> values;
+      for (const auto& column_id : column_ids) values.push_back((*chunk.get_column(column_id))[row]);
+      if (lookup % 2) {
+        values.back() = column_ids.back() == ColumnID{1} ? AllTypeVariant{type_cast<std::string>(values.back()) + "5"}
+                                                        : AllTypeVariant{type_cast<double>(values.back()) + 0.01};
+      }
+
+      ASSERT_EQ(tree->lower_bound(values) - tree->cbegin(), sorted->lower_bound(values) - sorted->cbegin());
+      ASSERT_EQ(tree->upper_bound(values) - tree->cbegin(), sorted->upper_bound(values) - sorted->cbegin());
+      values.resize(1);
+      ASSERT_EQ(tree->upper_bound(values) - tree->cbegin(), sorted->upper_bound(values) - sorted->cbegin());
+    }
+  }
+}
+
+TEST_F(StorageIndexTest, GetIndicesFor) {
+  const auto name_index = _chunk.create_index<GroupKeyIndex>({ColumnID{0}});
+  const auto composite_index = _chunk.create_index<SortedPositionIndex>({ColumnID{0}, ColumnID{1}});
+  EXPECT_EQ(_chunk.indices().size(), 2u);
+
+  EXPECT_EQ(_chunk.get_indices_for({ColumnID{0}}),
+            (std::vector<std::shared_ptr<const BaseIndex>>{name_index, composite_index}));
+  EXPECT_EQ(_chunk.get_indices_for({ColumnID{0}, ColumnID{1}}),
+            (std::vector<std::shared_ptr<const BaseIndex>>{composite_index}));
+  // the indexed columns must be a prefix of the index's columns
+  EXPECT_TRUE(_chunk.get_indices_for({ColumnID{1}}).empty());
+  EXPECT_TRUE(_chunk.get_indices_for({ColumnID{1}, ColumnID{0}}).empty());
+}
+
+}  // namespace opossum
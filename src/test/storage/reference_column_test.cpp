@@ -0,0 +1,74 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageReferenceColumnTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->append({1, "one"});
+    _table->append({2, "two"});
+    _table->append({3, "three"});
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageReferenceColumnTest, RetrieveValues) {
+  auto pos_list = std::make_shared<PosList>(PosList{{ChunkID{1}, 0}, {ChunkID{0}, 0}});
+  ReferenceColumn column{_table, ColumnID{1}, pos_list};
+
+  EXPECT_EQ(column.size(), 2u);
+  EXPECT_EQ(type_cast<std::string>(column[0]), "three");
+  EXPECT_EQ(type_cast<std::string>(column[1]), "one");
+  EXPECT_EQ(column.pos_list(), pos_list);
+  EXPECT_EQ(column.referenced_table(), _table);
+  EXPECT_EQ(column.referenced_column_id(), ColumnID{1});
+}
+
+TEST_F(StorageReferenceColumnTest, NullPositions) {
+  auto pos_list = std::make_shared<PosList>(PosList{{ChunkID{0}, 1}, NULL_ROW_ID});
+  ReferenceColumn column{_table, ColumnID{0}, pos_list};
+
+  EXPECT_EQ(type_cast<int32_t>(column[0]), 2);
+  EXPECT_THROW(column[1], std::logic_error);
+}
+
+TEST_F(StorageReferenceColumnTest, Immutable) {
+  ReferenceColumn column{_table, ColumnID{0}, std::make_shared<PosList>()};
+  EXPECT_THROW(column.append(4), std::exception);
+}
+
+TEST_F(StorageReferenceColumnTest, ReferenceTable) {
+  auto pos_list = std::make_shared<PosList>(PosList{{ChunkID{0}, 1}});
+  Chunk chunk;
+  chunk.add_column(std::make_shared<ReferenceColumn>(_table, ColumnID{0}, pos_list));
+  chunk.add_column(std::make_shared<ReferenceColumn>(_table, ColumnID{1}, pos_list));
+
+  auto reference_table = std::make_shared<Table>();
+  reference_table->add_column_definition("a", "int");
+  reference_table->add_column_definition("b", "string");
+  reference_table->emplace_chunk(std::move(chunk));
+
+  EXPECT_EQ(reference_table->chunk_count(), 1u);
+  EXPECT_EQ(reference_table->row_count(), 1u);
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  expected->append({2, "two"});
+  EXPECT_TABLE_EQ(reference_table, expected);
+}
+
+}  // namespace opossum
@@ -1,4 +1,8 @@
+#include <atomic>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -50,4 +54,51 @@ TEST_F(StorageStorageManagerTest, HasTable) {
   EXPECT_EQ(sm.has_table("first_table"), true);
 }
 
+TEST_F(StorageStorageManagerTest, ConcurrentAccess) {
+  auto& sm = StorageManager::get();
+  std::atomic_bool loader_done{false};
+
+  // one loader thread registers and drops tables while readers keep looking up an existing one
+  std::thread loader([&]() {
+    for (auto i = 0; i < 1000; ++i) {
+      sm.add_table("table_" + std::to_string(i), std::make_shared<Table>());
+      if (i % 2 == 0) sm.drop_table("table_" + std::to_string(i));
+    }
+    loader_done = true;
+  });
+
+  std::vector<std::thread> readers;
+  for (auto reader_id = 0; reader_id < 4; ++reader_id) {
+    readers.emplace_back([&]() {
+      while (!loader_done) {
+        EXPECT_NE(sm.get_table("first_table"), nullptr);
+        sm.has_table("table_1");
+        sm.table_names();
+      }
+    });
+  }
+
+  loader.join();
+  for (auto& reader : readers) reader.join();
+
+  EXPECT_EQ(sm.table_names().size(), 502u);
+  EXPECT_TRUE(sm.has_table("table_999"));
+  EXPECT_FALSE(sm.has_table("table_998"));
+}
+
+TEST_F(StorageStorageManagerTest, LookupsSeeChangesOfOtherThreads) {
+  auto& sm = StorageManager::get();
+  // the main thread caches the current tables before another thread changes them
+  EXPECT_FALSE(sm.has_table("third_table"));
+
+  std::thread([&]() {
+    sm.add_table("third_table", std::make_shared<Table>());
+    sm.drop_table("first_table");
+  }).join();
+
+  EXPECT_TRUE(sm.has_table("third_table"));
+  EXPECT_FALSE(sm.has_table("first_table"));
+  EXPECT_EQ(sm.table_names().size(), 2u);
+}
+
 }  // namespace opossum
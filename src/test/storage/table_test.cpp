@@ -1,14 +1,19 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_column.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
 
 namespace opossum {
 
@@ -71,4 +76,157 @@ TEST_F(StorageTableTest, GetColumnIdByName) {
 
 TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.chunk_size(), 2u); }
 
+TEST_F(StorageTableTest, AppendColumnBatch) {
+  t.append({4, "Hello,"});
+
+  auto ints = std::make_shared<ValueColumn<int32_t>>(std::vector<int32_t>{6, 3, 8, 9});
+  auto strings = std::make_shared<ValueColumn<std::string>>(std::vector<std::string>{"world", "!", "foo", "bar"});
+  t.append_column_batch({ints, strings});
+
+  // the first row fills up the existing chunk, the remaining ones are split at chunk_size() boundaries
+  EXPECT_EQ(t.row_count(), 5u);
+  EXPECT_EQ(t.chunk_count(), 3u);
+
+  const auto& last_column = static_cast<const ValueColumn<int32_t>&>(*t.get_chunk(ChunkID{2}).get_column(ColumnID{0}));
+  EXPECT_EQ(last_column.get_typed(0), 9);
+  const auto& first_column =
+      static_cast<const ValueColumn<std::string>&>(*t.get_chunk(ChunkID{0}).get_column(ColumnID{1}));
+  EXPECT_EQ(first_column.get_typed(1), "world");
+}
+
+TEST_F(StorageTableTest, AppendColumnBatchUnlimitedChunkSize) {
+  Table table;
+  table.add_column("col_1", "long");
+  table.append_column_batch({std::make_shared<ValueColumn<int64_t>>(std::vector<int64_t>(1000, 42))});
+  EXPECT_EQ(table.chunk_count(), 1u);
+  EXPECT_EQ(table.row_count(), 1000u);
+}
+
+TEST_F(StorageTableTest, AppendColumnBatchInvalid) {
+  auto ints = std::make_shared<ValueColumn<int32_t>>(std::vector<int32_t>{1, 2});
+  auto strings = std::make_shared<ValueColumn<std::string>>(std::vector<std::string>{"one"});
+  EXPECT_THROW(t.append_column_batch({ints}), std::exception);
+  EXPECT_THROW(t.append_column_batch({ints, strings}), std::exception);
+  EXPECT_THROW(t.append_column_batch({strings, ints}), std::exception);
+
+  // a column of the wrong type is detected before any values are moved into the table
+  auto other_ints = std::make_shared<ValueColumn<int32_t>>(std::vector<int32_t>{3, 4});
+  EXPECT_THROW(t.append_column_batch({ints, other_ints}), std::logic_error);
+  EXPECT_EQ(t.row_count(), 0u);
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  EXPECT_EQ(chunk.get_column(ColumnID{0})->size(), 0u);
+  EXPECT_EQ(chunk.get_column(ColumnID{1})->size(), 0u);
+  EXPECT_EQ(ints->values().size(), 2u);
+}
+
+TEST_F(StorageTableTest, CompressChunk) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+
+  t.compress_chunk(ChunkID{0});
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_EQ(t.row_count(), 3u);
+
+  auto column = t.get_chunk(ChunkID{0}).get_column(ColumnID{1});
+  auto dict_col = std::dynamic_pointer_cast<DictionaryColumn<std::string>>(column);
+  ASSERT_NE(dict_col, nullptr);
+  EXPECT_EQ(dict_col->get(1), "world");
+
+  // compressing the last chunk seals it, so that further rows go into a new chunk
+  t.compress_chunk(ChunkID{1});
+  EXPECT_EQ(t.chunk_count(), 3u);
+  t.append({8, "again"});
+  EXPECT_EQ(t.row_count(), 4u);
+  EXPECT_EQ(t.get_chunk(ChunkID{2}).size(), 1u);
+}
+
+TEST_F(StorageTableTest, ChunksArePreallocated) {
+  const auto capacity = [&](ChunkID chunk_id) {
+    const auto column = std::static_pointer_cast<ValueColumn<int>>(t.get_chunk(chunk_id).get_column(ColumnID{0}));
+    return column->values().capacity();
+  };
+
+  EXPECT_EQ(capacity(ChunkID{0}), 2u);
+  t.append({4, "Hello,"});
+  t.create_new_chunk();
+  EXPECT_EQ(capacity(ChunkID{0}), 1u);
+  EXPECT_EQ(capacity(ChunkID{1}), 2u);
+
+  // a column that is added later only reserves memory in the last chunk
+  Table table{2};
+  table.add_column("a", "int");
+  table.append({1});
+  table.create_new_chunk();
+  table.add_column("b", "long");
+  const auto& sealed_column = *table.get_chunk(ChunkID{0}).get_column(ColumnID{1});
+  EXPECT_EQ(static_cast<const ValueColumn<int64_t>&>(sealed_column).values().capacity(), 0u);
+  const auto& last_column = *table.get_chunk(ChunkID{1}).get_column(ColumnID{1});
+  EXPECT_EQ(static_cast<const ValueColumn<int64_t>&>(last_column).values().capacity(), 2u);
+}
+
+TEST_F(StorageTableTest, AppendConcurrently) {
+  const auto thread_count = 4;
+  const auto rows_per_thread = 1001;
+
+  Table table{100};
+  table.add_column("thread", "int");
+  table.add_column("row", "long");
+
+  std::vector<std::thread> threads;
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto row = 0; row < rows_per_thread; ++row) {
+        table.append_concurrently({thread_id, int64_t{row}});
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // all full chunks have been added, the remaining rows are still staged
+  EXPECT_EQ(table.row_count(), 4000u);
+  table.flush_concurrent_appends();
+  EXPECT_EQ(table.row_count(), 4004u);
+  EXPECT_EQ(table.chunk_count(), 41u);
+  EXPECT_EQ(table.get_chunk(ChunkID{40}).size(), 4u);
+
+  // every row has been written exactly once and with both of its values
+  std::vector<std::vector<bool>> seen(thread_count, std::vector<bool>(rows_per_thread, false));
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    const auto& thread_ids = std::dynamic_pointer_cast<ValueColumn<int>>(chunk.get_column(ColumnID{0}))->values();
+    const auto& rows = std::dynamic_pointer_cast<ValueColumn<int64_t>>(chunk.get_column(ColumnID{1}))->values();
+    for (size_t chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+      EXPECT_FALSE(seen[thread_ids[chunk_offset]][rows[chunk_offset]]);
+      seen[thread_ids[chunk_offset]][rows[chunk_offset]] = true;
+    }
+  }
+}
+
+TEST_F(StorageTableTest, AppendAfterFlush) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int");
+  table->append_concurrently({1});
+  table->append_concurrently({2});
+  table->flush_concurrent_appends();
+
+  // the flushed chunk is sealed, so further rows go into a new chunk that scans do not skip
+  table->append({100});
+  table->append_column_batch({std::make_shared<ValueColumn<int32_t>>(std::vector<int32_t>{100})});
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0}).size(), 2u);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 100);
+  table_scan->execute();
+  EXPECT_EQ(table_scan->get_output()->row_count(), 2u);
+}
+
+TEST_F(StorageTableTest, AppendConcurrentlyNeedsChunkSize) {
+  Table table;
+  table.add_column("col_1", "int");
+  EXPECT_THROW(table.append_concurrently({1}), std::exception);
+}
+
 }  // namespace opossum
@@ -1,5 +1,7 @@
+#include <iterator>
 #include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "../base_test.hpp"
@@ -47,4 +49,35 @@ TEST_F(StorageValueColumnTest, AddValueOfDifferentType) {
   EXPECT_THROW(vc_double.append("Hi"), std::exception);
 }
 
+TEST_F(StorageValueColumnTest, AppendValues) {
+  ValueColumn<int> column{std::vector<int>{1, 2}};
+  EXPECT_EQ(column.size(), 2u);
+
+  column.append_values(pmr_vector<int>{3, 4, 5});
+  EXPECT_EQ(column.size(), 5u);
+  EXPECT_EQ(column.get_typed(4), 5);
+
+  pmr_vector<std::string> strings{"a", "b"};
+  vc_str.append_values(std::move(strings));
+  EXPECT_EQ(vc_str.values(), (pmr_vector<std::string>{"a", "b"}));
+}
+
+TEST_F(StorageValueColumnTest, TypedAccess) {
+  vc_int.append(3);
+  vc_int.append(5);
+  vc_int.append(8);
+
+  EXPECT_EQ(vc_int.get_typed(1), 5);
+  EXPECT_EQ(vc_int.values().size(), 3u);
+  EXPECT_EQ(vc_int.data()[2], 8);
+  EXPECT_EQ(std::distance(vc_int.cbegin(), vc_int.cend()), 3);
+
+  auto sum = 0;
+  for (const auto value : vc_int) sum += value;
+  EXPECT_EQ(sum, 16);
+
+  vc_str.append("Hello");
+  EXPECT_EQ(vc_str.get_typed(0), "Hello");
+}
+
 }  // namespace opossum
@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/statistics/table_statistics.hpp"
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/zone_map.hpp"
+
+namespace opossum {
+
+class StorageZoneMapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->append({5, "b"});
+    _table->append({2, "z"});
+    _table->append({9, "m"});
+    _table->append({12, "a"});
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageZoneMapTest, ComputedWhenChunkIsSealed) {
+  const auto& sealed_chunk = _table->get_chunk(ChunkID{0});
+  ASSERT_TRUE(sealed_chunk.is_sealed());
+  EXPECT_EQ(sealed_chunk.zone_map(ColumnID{0})->min, AllTypeVariant{2});
+  EXPECT_EQ(sealed_chunk.zone_map(ColumnID{0})->max, AllTypeVariant{9});
+  EXPECT_EQ(sealed_chunk.zone_map(ColumnID{1})->min, AllTypeVariant{"b"});
+  EXPECT_EQ(sealed_chunk.zone_map(ColumnID{1})->max, AllTypeVariant{"z"});
+
+  // the last chunk still receives rows
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1}).is_sealed());
+
+  // compressing the last chunk seals it
+  _table->append({7, "c"});
+  _table->compress_chunk(ChunkID{1});
+  const auto& compressed_chunk = _table->get_chunk(ChunkID{1});
+  ASSERT_TRUE(compressed_chunk.is_sealed());
+  EXPECT_EQ(compressed_chunk.zone_map(ColumnID{0})->min, AllTypeVariant{7});
+  EXPECT_EQ(compressed_chunk.zone_map(ColumnID{0})->max, AllTypeVariant{12});
+  EXPECT_EQ(compressed_chunk.zone_map(ColumnID{1})->max, AllTypeVariant{"c"});
+}
+
+TEST_F(StorageZoneMapTest, ConcurrentAppends) {
+  _table = std::make_shared<Table>(2);
+  _table->add_column("a", "long");
+  _table->append_concurrently({int64_t{4}});
+  _table->append_concurrently({int64_t{-1}});
+  _table->append_concurrently({int64_t{3}});
+  _table->flush_concurrent_appends();
+
+  ASSERT_EQ(_table->chunk_count(), 2u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0}).zone_map(ColumnID{0})->min, AllTypeVariant{int64_t{-1}});
+  EXPECT_EQ(_table->get_chunk(ChunkID{1}).zone_map(ColumnID{0})->max, AllTypeVariant{int64_t{3}});
+}
+
+TEST_F(StorageZoneMapTest, NoZoneMapsForEmptyOrReferenceChunks) {
+  Chunk empty_chunk;
+  EXPECT_TRUE(create_zone_maps(empty_chunk, {}).empty());
+
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 0);
+  scan->execute();
+  const auto& output = *scan->get_output();
+  const auto zone_maps = create_zone_maps(output.get_chunk(ChunkID{0}), {"int", "string"});
+  ASSERT_EQ(zone_maps.size(), 2u);
+  EXPECT_FALSE(zone_maps[0]);
+  EXPECT_FALSE(zone_maps[1]);
+}
+
+TEST_F(StorageZoneMapTest, NoZoneMapsForColumnsWithNaN) {
+  // orders NaN after all numbers, so that next_permutation visits every position of the NaN
+  const auto nan_last = [](const double lhs, const double rhs) {
+    return std::isnan(rhs) ? !std::isnan(lhs) : !std::isnan(lhs) && lhs < rhs;
+  };
+  auto values = std::vector<double>{1.0, 3.0, 5.0, std::numeric_limits<double>::quiet_NaN()};
+
+  // the scans must find the 5 and the values that are != 5, no matter where the NaN is
+  do {
+    auto table = std::make_shared<Table>(4);
+    table->add_column("a", "double");
+    table->add_column("b", "int");
+    for (const auto value : values) table->append({value, 1});
+    // seals the first chunk
+    table->append({7.0, 2});
+    ASSERT_EQ(table->chunk_count(), 2u);
+    const auto& sealed_chunk = table->get_chunk(ChunkID{0});
+    EXPECT_TRUE(sealed_chunk.is_sealed());
+    // only the column with the NaN has no zone map
+    EXPECT_FALSE(sealed_chunk.zone_map(ColumnID{0}));
+    ASSERT_TRUE(sealed_chunk.zone_map(ColumnID{1}));
+    EXPECT_EQ(sealed_chunk.zone_map(ColumnID{1})->max, AllTypeVariant{1});
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    auto equals_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 5.0);
+    equals_scan->execute();
+    EXPECT_EQ(equals_scan->get_output()->row_count(), 1u);
+    auto not_equals_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 5.0);
+    not_equals_scan->execute();
+    EXPECT_EQ(not_equals_scan->get_output()->row_count(), 4u);
+  } while (std::next_permutation(values.begin(), values.end(), nan_last));
+
+  // a chunk without NaN still gets its zone maps
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "float");
+  table->append({1.0f});
+  table->append({-2.0f});
+  table->append({3.0f});
+  ASSERT_TRUE(table->get_chunk(ChunkID{0}).is_sealed());
+  EXPECT_EQ(table->get_chunk(ChunkID{0}).zone_map(ColumnID{0})->min, AllTypeVariant{-2.0f});
+}
+
+TEST_F(StorageZoneMapTest, ChunksWithNaNStaySealed) {
+  // the partial chunk of flush_concurrent_appends() is sealed although its column has no zone map
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "double");
+  table->append_concurrently({1.0});
+  table->append_concurrently({std::numeric_limits<double>::quiet_NaN()});
+  table->flush_concurrent_appends();
+  table->append({2.0});
+
+  ASSERT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0}).size(), 2u);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0}).is_sealed());
+
+  // sealing the second chunk must not count the first one again
+  table->create_new_chunk();
+  EXPECT_EQ(table->table_statistics()->row_count(), 3u);
+}
+
+TEST_F(StorageZoneMapTest, MayMatch) {
+  const auto zone_map = ZoneMap{10, 20};
+  const auto may_match = [&](const ScanType scan_type, const int32_t value, const int32_t value2 = 0) {
+    return zone_map_may_match(zone_map, scan_type, value, value2);
+  };
+
+  EXPECT_TRUE(may_match(ScanType::OpEquals, 10));
+  EXPECT_TRUE(may_match(ScanType::OpEquals, 20));
+  EXPECT_FALSE(may_match(ScanType::OpEquals, 9));
+  EXPECT_FALSE(may_match(ScanType::OpEquals, 21));
+  EXPECT_TRUE(may_match(ScanType::OpNotEquals, 10));
+  EXPECT_FALSE(may_match(ScanType::OpLessThan, 10));
+  EXPECT_TRUE(may_match(ScanType::OpLessThan, 11));
+  EXPECT_TRUE(may_match(ScanType::OpLessThanEquals, 10));
+  EXPECT_FALSE(may_match(ScanType::OpLessThanEquals, 9));
+  EXPECT_FALSE(may_match(ScanType::OpGreaterThan, 20));
+  EXPECT_TRUE(may_match(ScanType::OpGreaterThan, 19));
+  EXPECT_TRUE(may_match(ScanType::OpGreaterThanEquals, 20));
+  EXPECT_FALSE(may_match(ScanType::OpGreaterThanEquals, 21));
+  EXPECT_TRUE(may_match(ScanType::OpBetween, 0, 10));
+  EXPECT_TRUE(may_match(ScanType::OpBetween, 15, 16));
+  EXPECT_TRUE(may_match(ScanType::OpBetween, 20, 30));
+  EXPECT_FALSE(may_match(ScanType::OpBetween, 0, 9));
+  EXPECT_FALSE(may_match(ScanType::OpBetween, 21, 30));
+
+  // a chunk that only holds a single value never matches != that value
+  const auto single_value = ZoneMap{std::string{"x"}, std::string{"x"}};
+  EXPECT_FALSE(zone_map_may_match<std::string>(single_value, ScanType::OpNotEquals, "x", ""));
+  EXPECT_TRUE(zone_map_may_match<std::string>(single_value, ScanType::OpNotEquals, "y", ""));
+}
+
+TEST_F(StorageZoneMapTest, ScanSkipsChunks) {
+  // the scan result must not change, no matter how many chunks are skipped
+  auto table = std::make_shared<Table>(100);
+  table->add_column("timestamp", "long");
+  for (auto timestamp = int64_t{0}; timestamp < 1000; ++timestamp) table->append({timestamp});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpBetween, int64_t{250},
+                                          int64_t{349});
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 100u);
+  EXPECT_EQ(scan->get_output()->get_chunk(ChunkID{0}).get_column(ColumnID{0})->operator[](0),
+            AllTypeVariant{int64_t{250}});
+}
+
+}  // namespace opossum
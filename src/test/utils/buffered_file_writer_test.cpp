@@ -0,0 +1,47 @@
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/utils/buffered_file_writer.hpp"
+
+namespace opossum {
+
+class UtilsBufferedFileWriterTest : public BaseTest {
+ protected:
+  void SetUp() override { _filename = ::testing::TempDir() + "opossum_buffered_file_writer_test"; }
+
+  std::string _file_content() const {
+    std::ifstream stream(_filename);
+    std::stringstream content;
+    content << stream.rdbuf();
+    return content.str();
+  }
+
+  std::string _filename;
+};
+
+TEST_F(UtilsBufferedFileWriterTest, PiecesOfAllSizes) {
+  std::string expected;
+  {
+    BufferedFileWriter writer(_filename, 4);
+    for (const auto piece : {"a", "bcd", "efgh", "ijklmnopq", "", "r", "stuv", "w"}) {
+      writer.write(piece, std::string(piece).size());
+      expected += piece;
+    }
+    writer.flush();
+    EXPECT_EQ(_file_content(), expected);
+
+    writer.write("xy", 2);
+  }
+  // the destructor writes what is left in the buffer
+  EXPECT_EQ(_file_content(), expected + "xy");
+}
+
+TEST_F(UtilsBufferedFileWriterTest, InvalidFile) {
+  EXPECT_THROW(BufferedFileWriter("/does/not/exist"), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/utils/normalized_key.hpp"
+
+namespace opossum {
+
+class UtilsNormalizedKeyTest : public BaseTest {
+ protected:
+  // checks that the keys of the sorted values are sorted as well and that they decode to the values again
+  template <typename T>
+  void _expect_order_preserving(const std::vector<T>& sorted_values) {
+    for (const auto descending : {false, true}) {
+      std::vector<std::string> keys;
+      for (const auto& value : sorted_values) {
+        std::string key;
+        append_normalized_key(key, value, descending);
+        keys.push_back(key);
+
+        auto position = size_t{0};
+        EXPECT_EQ(read_normalized_key<T>(key, position, descending), value);
+        EXPECT_EQ(position, key.size());
+      }
+
+      for (size_t index = 1; index < keys.size(); ++index) {
+        EXPECT_EQ(keys[index - 1] < keys[index], !descending);
+      }
+    }
+  }
+};
+
+TEST_F(UtilsNormalizedKeyTest, Integers) {
+  _expect_order_preserving<int32_t>({std::numeric_limits<int32_t>::min(), -256, -1, 0, 1, 255, 256,
+                                     std::numeric_limits<int32_t>::max()});
+  _expect_order_preserving<int64_t>({std::numeric_limits<int64_t>::min(), -1, 0, int64_t{1} << 40,
+                                     std::numeric_limits<int64_t>::max()});
+}
+
+TEST_F(UtilsNormalizedKeyTest, FloatingPointNumbers) {
+  _expect_order_preserving<float>({-std::numeric_limits<float>::infinity(), -2.5f, -1e-10f, 0.0f, 1e-10f, 2.5f,
+                                   std::numeric_limits<float>::infinity()});
+  _expect_order_preserving<double>({std::numeric_limits<double>::lowest(), -0.5, 0.0, 0.25, 1e300});
+
+  std::string positive_zero;
+  append_normalized_key(positive_zero, 0.0);
+  std::string negative_zero;
+  append_normalized_key(negative_zero, -0.0);
+  EXPECT_EQ(positive_zero, negative_zero);
+}
+
+TEST_F(UtilsNormalizedKeyTest, Strings) {
+  _expect_order_preserving<std::string>(
+      {"", std::string(1, '\0'), "a", std::string("a\0", 2), std::string("a\0b", 3), "ab", "b", "\xff"});
+}
+
+TEST_F(UtilsNormalizedKeyTest, MultipleValues) {
+  // ("a", 2) < ("ab", 1) < ("ab", 3) < ("b", -5)
+  const auto key = [](const std::string& first, const int32_t second) {
+    std::string key;
+    append_normalized_key(key, first);
+    append_normalized_key(key, second);
+    return key;
+  };
+
+  EXPECT_LT(key("a", 2), key("ab", 1));
+  EXPECT_LT(key("ab", 1), key("ab", 3));
+  EXPECT_LT(key("ab", 3), key("b", -5));
+
+  const auto encoded = key("ab", 3);
+  auto position = size_t{0};
+  EXPECT_EQ(read_normalized_key<std::string>(encoded, position), "ab");
+  EXPECT_EQ(read_normalized_key<int32_t>(encoded, position), 3);
+}
+
+}  // namespace opossum